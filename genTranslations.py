@@ -0,0 +1,172 @@
+import os
+import sys
+
+# Génère le pool de chaînes traduites à partir de src/Translation/strings.csv
+#
+#   src/Translation/text_pool.hpp : enum StrId + déclarations
+#   src/Translation/text_pool.cpp : pool unique (flash) + table des offsets
+#
+# Utilisation :
+#   python genTranslations.py           génère les fichiers
+#   python genTranslations.py --check   vérifie seulement (traductions manquantes)
+# PlatformIO l'exécute avant chaque build (extra_scripts = pre:genTranslations.py).
+
+SOURCE = os.path.join("src", "Translation", "strings.csv")
+HEADER = os.path.join("src", "Translation", "text_pool.hpp")
+SOURCE_CPP = os.path.join("src", "Translation", "text_pool.cpp")
+
+NOTICE = "// Généré par genTranslations.py depuis strings.csv : ne pas modifier à la main.\n"
+
+
+def parse_table(path):
+    # Retourne (langues, [(id, [textes])], erreurs)
+    languages = None
+    rows = []
+    errors = []
+    seen = set()
+
+    with open(path, encoding="utf-8") as f:
+        for number, line in enumerate(f, 1):
+            line = line.rstrip("\r\n")
+            if not line.strip() or line.startswith("#"):
+                continue
+            cells = line.split(";")
+            if languages is None:
+                if cells[0] != "id" or len(cells) < 2:
+                    errors.append(f"{path}:{number}: en-tête attendu 'id;<langue>;...'")
+                    return [], [], errors
+                languages = cells[1:]
+                continue
+
+            key = cells[0].strip()
+            texts = cells[1:]
+            if len(texts) != len(languages):
+                errors.append(f"{path}:{number}: '{key}' a {len(texts)} colonnes, {len(languages)} attendues")
+                texts = (texts + [""] * len(languages))[:len(languages)]
+            if key in seen:
+                errors.append(f"{path}:{number}: identifiant '{key}' en double")
+            seen.add(key)
+            for lang, text in zip(languages, texts):
+                if not text:
+                    errors.append(f"{path}:{number}: '{key}' : traduction '{lang}' manquante")
+            rows.append((key, [t.replace("\\n", "\n") for t in texts]))
+
+    if languages is None:
+        errors.append(f"{path}: fichier vide")
+        return [], [], errors
+    return languages, rows, errors
+
+
+def enum_name(key):
+    return key.replace(".", "_").upper()
+
+
+def c_string(text):
+    out = []
+    for ch in text:
+        if ch == "\\":
+            out.append("\\\\")
+        elif ch == "\"":
+            out.append("\\\"")
+        elif ch == "\n":
+            out.append("\\n")
+        else:
+            out.append(ch)
+    return "".join(out)
+
+
+def build_pool(rows):
+    # Chaînes identiques partagées : une seule copie dans le pool
+    offsets = {}
+    pool = []
+    size = 0
+    table = []
+    for key, texts in rows:
+        entry = []
+        for text in texts:
+            if text not in offsets:
+                offsets[text] = size
+                pool.append(text)
+                size += len(text.encode("utf-8")) + 1
+            entry.append(offsets[text])
+        table.append(entry)
+    return pool, table, size
+
+
+def render(languages, rows):
+    pool, table, size = build_pool(rows)
+    if size > 0xFFFF:
+        raise ValueError(f"pool de {size} octets : les offsets uint16_t ne suffisent plus")
+
+    header = [NOTICE,
+              "#pragma once\n",
+              "#include <cstdint>\n",
+              f"/** @brief Identifiants des chaînes traduites ({len(rows)} chaînes) */",
+              "enum class StrId : uint16_t {"]
+    header += [f"    {enum_name(key)}," for key, _ in rows]
+    header += ["    COUNT",
+               "};\n",
+               "namespace TextPool {",
+               f"    constexpr uint8_t LANGUAGE_COUNT = {len(languages)};",
+               f"    constexpr uint16_t POOL_SIZE = {size};",
+               "    extern const char POOL[POOL_SIZE];",
+               "    extern const uint16_t OFFSET[static_cast<uint16_t>(StrId::COUNT)][LANGUAGE_COUNT];",
+               "}\n"]
+
+    cpp = [NOTICE,
+           "#include \"text_pool.hpp\"\n",
+           "namespace TextPool {\n",
+           f"// {len(pool)} chaînes distinctes, langues : {', '.join(languages)}",
+           "const char POOL[POOL_SIZE] ="]
+    cpp += [f"    \"{c_string(text)}\\0\"" for text in pool[:-1]]
+    # La dernière chaîne utilise le '\0' final du littéral
+    cpp += [f"    \"{c_string(pool[-1])}\";\n"]
+    cpp += ["const uint16_t OFFSET[static_cast<uint16_t>(StrId::COUNT)][LANGUAGE_COUNT] = {"]
+    cpp += [f"    {{ {', '.join(str(o) for o in entry)} }}, // {key}" for (key, _), entry in zip(rows, table)]
+    cpp += ["};\n",
+            "} // namespace TextPool\n"]
+    return "\n".join(header), "\n".join(cpp), size
+
+
+def write_if_changed(path, content):
+    # Ne réécrit pas un fichier identique (évite de tout recompiler)
+    if os.path.exists(path):
+        with open(path, encoding="utf-8") as f:
+            if f.read() == content:
+                return False
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(content)
+    return True
+
+
+def generate(project_dir, check_only=False):
+    languages, rows, errors = parse_table(os.path.join(project_dir, SOURCE))
+    if errors:
+        for error in errors:
+            print(f"Erreur : {error}")
+        return False
+    if not rows:
+        print(f"Erreur : aucune chaîne dans {SOURCE}")
+        return False
+
+    header, cpp, size = render(languages, rows)
+    if check_only:
+        print(f"Traductions OK : {len(rows)} chaînes, {len(languages)} langues, pool de {size} octets")
+        return True
+
+    changed = write_if_changed(os.path.join(project_dir, HEADER), header)
+    changed |= write_if_changed(os.path.join(project_dir, SOURCE_CPP), cpp)
+    state = "régénérées" if changed else "à jour"
+    print(f"Traductions {state} : {len(rows)} chaînes, {len(languages)} langues, pool de {size} octets")
+    return True
+
+
+try:
+    Import("env")  # noqa: F821 (script PlatformIO)
+    if not generate(env.subst("$PROJECT_DIR")):  # noqa: F821
+        env.Exit(1)  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        check = "--check" in sys.argv[1:]
+        here = os.path.dirname(os.path.abspath(__file__))
+        sys.exit(0 if generate(here, check) else 1)
@@ -11,8 +11,12 @@
 #define LV_COLOR_16_SWAP 0
 
 /* Memory settings */
-#define LV_MEM_CUSTOM 0
-#define LV_MEM_SIZE (48 * 1024U)
+/* One PSRAM arena per page, see src/screen/LVGLArena.hpp */
+#define LV_MEM_CUSTOM 1
+#define LV_MEM_CUSTOM_INCLUDE "lv_mem_arena.h"
+#define LV_MEM_CUSTOM_ALLOC lv_arena_alloc
+#define LV_MEM_CUSTOM_FREE lv_arena_free
+#define LV_MEM_CUSTOM_REALLOC lv_arena_realloc
 
 /* Display settings */
 #define LV_HOR_RES_MAX 480
@@ -77,6 +81,9 @@
 #define LV_USE_TEXTAREA 1
 #define LV_USE_TABLE 1
 
+/* Extra widgets */
+#define LV_USE_KEYBOARD 1
+
 /* Layouts */
 #define LV_USE_FLEX 1
 #define LV_USE_GRID 1
@@ -0,0 +1,24 @@
+/**
+ * @file lv_mem_arena.h
+ * LVGL custom allocator hooks (LV_MEM_CUSTOM_INCLUDE), implemented by
+ * src/screen/LVGLArena.cpp.
+ */
+
+#ifndef LV_MEM_ARENA_H
+#define LV_MEM_ARENA_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void* lv_arena_alloc(size_t size);
+void lv_arena_free(void* ptr);
+void* lv_arena_realloc(void* ptr, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LV_MEM_ARENA_H */
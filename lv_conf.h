@@ -14,8 +14,12 @@
 #define LV_COLOR_16_SWAP 0
 
 /* Memory settings */
-#define LV_MEM_CUSTOM 0
-#define LV_MEM_SIZE (48 * 1024U)
+/* One PSRAM arena per page, see src/screen/LVGLArena.hpp */
+#define LV_MEM_CUSTOM 1
+#define LV_MEM_CUSTOM_INCLUDE "lv_mem_arena.h"
+#define LV_MEM_CUSTOM_ALLOC lv_arena_alloc
+#define LV_MEM_CUSTOM_FREE lv_arena_free
+#define LV_MEM_CUSTOM_REALLOC lv_arena_realloc
 
 /* Display settings */
 #define LV_HOR_RES_MAX 480
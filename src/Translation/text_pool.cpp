@@ -0,0 +1,203 @@
+// Généré par genTranslations.py depuis strings.csv : ne pas modifier à la main.
+
+#include "text_pool.hpp"
+
+namespace TextPool {
+
+// 122 chaînes distinctes, langues : fr, en
+const char POOL[POOL_SIZE] =
+    "Francais\0"
+    "English\0"
+    "Selection de la langue\0"
+    "Language selection\0"
+    "Calibration tactile\0"
+    "Touch calibration\0"
+    "Reinitialisation\0"
+    "Reset\0"
+    "Verrouillage\0"
+    "Lock\0"
+    "Sondes de niveaux\0"
+    "Level probes\0"
+    "Temp\0"
+    "Regulations\0"
+    "Paramètres\0"
+    "Settings\0"
+    "Alertes\0"
+    "Alerts\0"
+    "Historique pH/Redox\0"
+    "pH/Redox History\0"
+    "Pompe\0"
+    "Pump\0"
+    "Calibration Redox\0"
+    "Redox Calibration\0"
+    "Calibration pH\0"
+    "pH Calibration\0"
+    "WiFi\0"
+    "MQTT\0"
+    "Langue\0"
+    "Language\0"
+    "Remplissage piscine\0"
+    "Pool Fill\0"
+    "Interrupteur\0"
+    "Switch\0"
+    "Sonde de niveau de produit\0"
+    "Product Level Sensor\0"
+    "Ecran de verrouillage\0"
+    "Lock Screen\0"
+    "Ecran\0"
+    "Screen\0"
+    "Cloud\0"
+    "Réinitialiser\0"
+    "pH\0"
+    "Redox\0"
+    "Temperature\0"
+    "Activer la pompe\0"
+    "Enable pump\0"
+    "Vitesse\0"
+    "Speed\0"
+    "Activer les sondes\0"
+    "Enable probes\0"
+    "Seuil d'alerte (%)\0"
+    "Alert threshold (%)\0"
+    "Remplissage automatique\0"
+    "Auto fill\0"
+    "Niveau cible (%)\0"
+    "Target level (%)\0"
+    "Verrouiller l'écran\0"
+    "Lock screen\0"
+    "Délai de verrouillage (min)\0"
+    "Lock timeout (min)\0"
+    "Luminosité (%)\0"
+    "Brightness (%)\0"
+    "Timeout écran (sec)\0"
+    "Screen timeout (sec)\0"
+    "Calibrer le tactile\0"
+    "Calibrate touch\0"
+    "Interrupteur 1\0"
+    "Switch 1\0"
+    "Interrupteur 2\0"
+    "Switch 2\0"
+    "Interrupteur 3\0"
+    "Switch 3\0"
+    "pH actuel\0"
+    "Current pH\0"
+    "Point bas\n(pH 4.0)\0"
+    "Low point\n(pH 4.0)\0"
+    "Point milieu\n(pH 7.0)\0"
+    "Mid point\n(pH 7.0)\0"
+    "Point haut\n(pH 10.0)\0"
+    "High point\n(pH 10.0)\0"
+    "Redox actuel\0"
+    "Current Redox\0"
+    "Calibrer Redox\0"
+    "Calibrate Redox\0"
+    "Touchez le centre de chaque cible\0"
+    "Tap the center of each target\0"
+    "Annuler\0"
+    "Cancel\0"
+    "Activer WiFi\0"
+    "Enable WiFi\0"
+    "Nom du réseau (SSID)\0"
+    "Network name (SSID)\0"
+    "Mot de passe\0"
+    "Password\0"
+    "Se connecter\0"
+    "Connect\0"
+    "Réseaux disponibles\0"
+    "Available networks\0"
+    "Activer MQTT\0"
+    "Enable MQTT\0"
+    "Serveur MQTT\0"
+    "MQTT Server\0"
+    "Port\0"
+    "Topic\0"
+    "Tester connexion\0"
+    "Test connection\0"
+    "Activer Cloud\0"
+    "Enable Cloud\0"
+    "URL du serveur\0"
+    "Server URL\0"
+    "Attention: Ces actions sont irreversibles!\0"
+    "Warning: These actions are irreversible!\0"
+    "Reinitialiser\nles parametres\0"
+    "Reset\nSettings\0"
+    "Reinitialiser\nTout\0"
+    "Reset\nEverything\0"
+    "OUI\0"
+    "YES\0"
+    "NON\0"
+    "NO\0"
+    "OK";
+
+const uint16_t OFFSET[static_cast<uint16_t>(StrId::COUNT)][LANGUAGE_COUNT] = {
+    { 0, 9 }, // language.name
+    { 17, 40 }, // language.title
+    { 59, 79 }, // title.touch_calibration
+    { 97, 114 }, // title.reset
+    { 120, 133 }, // title.lock
+    { 138, 156 }, // title.level_probe
+    { 169, 169 }, // main.temperature
+    { 174, 174 }, // main.regulations_switch
+    { 174, 174 }, // main.pomp_switch
+    { 186, 198 }, // main.settings
+    { 207, 215 }, // main.alert
+    { 222, 242 }, // main.historique
+    { 259, 265 }, // settings.pump
+    { 270, 288 }, // settings.calibration_redox
+    { 306, 321 }, // settings.calibration_ph
+    { 336, 336 }, // settings.wifi
+    { 341, 341 }, // settings.mqtt
+    { 346, 353 }, // settings.language
+    { 362, 382 }, // settings.pool_fill
+    { 392, 405 }, // settings.switch
+    { 412, 439 }, // settings.product_level
+    { 460, 482 }, // settings.lock_screen
+    { 494, 500 }, // settings.screen
+    { 507, 507 }, // settings.cloud
+    { 513, 114 }, // settings.reset
+    { 528, 528 }, // pool.ph
+    { 531, 531 }, // pool.redox
+    { 537, 537 }, // pool.temperature
+    { 549, 566 }, // controls.pump_enable
+    { 578, 586 }, // controls.pump_speed
+    { 592, 611 }, // controls.probes_enable
+    { 625, 644 }, // controls.probes_threshold
+    { 664, 688 }, // controls.fill_auto
+    { 698, 715 }, // controls.fill_level
+    { 732, 753 }, // controls.lock_enable
+    { 765, 794 }, // controls.lock_timeout
+    { 813, 829 }, // controls.screen_brightness
+    { 844, 865 }, // controls.screen_timeout
+    { 886, 906 }, // controls.screen_calibrate_touch
+    { 922, 937 }, // controls.switch_1
+    { 946, 961 }, // controls.switch_2
+    { 970, 985 }, // controls.switch_3
+    { 994, 1004 }, // calibration.current_ph
+    { 1015, 1034 }, // calibration.point_low
+    { 1053, 1075 }, // calibration.point_mid
+    { 1094, 1115 }, // calibration.point_high
+    { 1136, 1149 }, // calibration.current_redox
+    { 1163, 1178 }, // calibration.calibrate_redox
+    { 1194, 1228 }, // calibration.touch_instructions
+    { 1258, 1266 }, // calibration.touch_cancel
+    { 1273, 1286 }, // network.wifi_enable
+    { 1298, 1320 }, // network.wifi_ssid
+    { 1340, 1353 }, // network.wifi_password
+    { 1362, 1375 }, // network.wifi_connect
+    { 1383, 1404 }, // network.wifi_networks
+    { 1423, 1436 }, // network.mqtt_enable
+    { 1448, 1461 }, // network.mqtt_server
+    { 1473, 1473 }, // network.mqtt_port
+    { 1478, 1478 }, // network.mqtt_topic
+    { 1484, 1501 }, // network.mqtt_test
+    { 1517, 1531 }, // network.cloud_enable
+    { 1544, 1559 }, // network.cloud_url
+    { 1570, 1613 }, // reset.warning
+    { 1654, 1683 }, // reset.settings
+    { 1698, 1717 }, // reset.all
+    { 1734, 1738 }, // dialog.yes
+    { 1742, 1746 }, // dialog.no
+    { 1749, 1749 }, // dialog.ok
+};
+
+} // namespace TextPool
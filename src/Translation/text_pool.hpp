@@ -0,0 +1,85 @@
+// Généré par genTranslations.py depuis strings.csv : ne pas modifier à la main.
+
+#pragma once
+
+#include <cstdint>
+
+/** @brief Identifiants des chaînes traduites (68 chaînes) */
+enum class StrId : uint16_t {
+    LANGUAGE_NAME,
+    LANGUAGE_TITLE,
+    TITLE_TOUCH_CALIBRATION,
+    TITLE_RESET,
+    TITLE_LOCK,
+    TITLE_LEVEL_PROBE,
+    MAIN_TEMPERATURE,
+    MAIN_REGULATIONS_SWITCH,
+    MAIN_POMP_SWITCH,
+    MAIN_SETTINGS,
+    MAIN_ALERT,
+    MAIN_HISTORIQUE,
+    SETTINGS_PUMP,
+    SETTINGS_CALIBRATION_REDOX,
+    SETTINGS_CALIBRATION_PH,
+    SETTINGS_WIFI,
+    SETTINGS_MQTT,
+    SETTINGS_LANGUAGE,
+    SETTINGS_POOL_FILL,
+    SETTINGS_SWITCH,
+    SETTINGS_PRODUCT_LEVEL,
+    SETTINGS_LOCK_SCREEN,
+    SETTINGS_SCREEN,
+    SETTINGS_CLOUD,
+    SETTINGS_RESET,
+    POOL_PH,
+    POOL_REDOX,
+    POOL_TEMPERATURE,
+    CONTROLS_PUMP_ENABLE,
+    CONTROLS_PUMP_SPEED,
+    CONTROLS_PROBES_ENABLE,
+    CONTROLS_PROBES_THRESHOLD,
+    CONTROLS_FILL_AUTO,
+    CONTROLS_FILL_LEVEL,
+    CONTROLS_LOCK_ENABLE,
+    CONTROLS_LOCK_TIMEOUT,
+    CONTROLS_SCREEN_BRIGHTNESS,
+    CONTROLS_SCREEN_TIMEOUT,
+    CONTROLS_SCREEN_CALIBRATE_TOUCH,
+    CONTROLS_SWITCH_1,
+    CONTROLS_SWITCH_2,
+    CONTROLS_SWITCH_3,
+    CALIBRATION_CURRENT_PH,
+    CALIBRATION_POINT_LOW,
+    CALIBRATION_POINT_MID,
+    CALIBRATION_POINT_HIGH,
+    CALIBRATION_CURRENT_REDOX,
+    CALIBRATION_CALIBRATE_REDOX,
+    CALIBRATION_TOUCH_INSTRUCTIONS,
+    CALIBRATION_TOUCH_CANCEL,
+    NETWORK_WIFI_ENABLE,
+    NETWORK_WIFI_SSID,
+    NETWORK_WIFI_PASSWORD,
+    NETWORK_WIFI_CONNECT,
+    NETWORK_WIFI_NETWORKS,
+    NETWORK_MQTT_ENABLE,
+    NETWORK_MQTT_SERVER,
+    NETWORK_MQTT_PORT,
+    NETWORK_MQTT_TOPIC,
+    NETWORK_MQTT_TEST,
+    NETWORK_CLOUD_ENABLE,
+    NETWORK_CLOUD_URL,
+    RESET_WARNING,
+    RESET_SETTINGS,
+    RESET_ALL,
+    DIALOG_YES,
+    DIALOG_NO,
+    DIALOG_OK,
+    COUNT
+};
+
+namespace TextPool {
+    constexpr uint8_t LANGUAGE_COUNT = 2;
+    constexpr uint16_t POOL_SIZE = 1752;
+    extern const char POOL[POOL_SIZE];
+    extern const uint16_t OFFSET[static_cast<uint16_t>(StrId::COUNT)][LANGUAGE_COUNT];
+}
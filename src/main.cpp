@@ -22,23 +22,19 @@
 #include "screen/DisplayLVGL.hpp"
 #include "screen/TouchController.hpp"
 #include "screen/LVGLTouchInput.hpp"
-#include "page/MainDisplayPageLVGL.hpp"
-#include "page/SettingsPageLVGL.hpp"
-#include "page/PumpPageLVGL.hpp"
-#include "page/CalibrationRedoxPageLVGL.hpp"
-#include "page/CalibrationPHPageLVGL.hpp"
-#include "page/SwitchPageLVGL.hpp"
-#include "page/PoolFillPageLVGL.hpp"
-#include "page/MQTTPageLVGL.hpp"
-#include "page/LevelProbePageLVGL.hpp"
-#include "page/LockPageLVGL.hpp"
-#include "page/ScreenPageLVGL.hpp"
-#include "page/LanguagePageLVGL.hpp"
-#include "page/CloudPageLVGL.hpp"
-#include "page/WiFiPageLVGL.hpp"
-#include "page/ResetPageLVGL.hpp"
 #include "page/utils/Page.hpp"
 #include "page/utils/PageManager.hpp"
+#include "page/utils/Notifications.hpp"
+#include "page/utils/UiStore.hpp"
+#include "page/utils/TextBindings.hpp"
+#include "page/utils/SteadyStateTest.hpp"
+#include "page/utils/SoakTest.hpp"
+#include "page/utils/UiQueue.hpp"
+#include "page/utils/DeviceState.hpp"
+#include "screen/LatencyTracker.hpp"
+#include "screen/LVGLArena.hpp"
+#include "screen/MemoryPolicy.hpp"
+#include "screen/UiTask.hpp"
 #include "Translation/text.hpp"
 
 DisplayLVGL* display;
@@ -49,6 +45,33 @@ LVGLTouchInput* touchLVGL;
  */
 Text translator;
 PageManager* pageManager;
+LoadMeter loopLoad;
+
+/**
+ * @brief Copies the device state into the UI store when it has changed
+ * (one consistent snapshot per frame, whoever wrote it).
+ */
+static void syncDeviceState() {
+    static uint32_t seen = 0;
+    DeviceSnapshot state;
+    if (!DeviceState::readIfChanged(state, seen)) return;
+    UiStore::set(UiKey::PH, state.ph);
+    UiStore::set(UiKey::REDOX, state.redox);
+    UiStore::set(UiKey::TEMPERATURE, state.temperature);
+    UiStore::set(UiKey::POWER_ON, state.powerOn);
+    UiStore::set(UiKey::PUMP_ON, state.pumpOn);
+    UiStore::set(UiKey::PUMP_SPEED, state.pumpSpeed);
+}
+
+/**
+ * @brief Per-frame UI work, run by the UI task under the UI lock.
+ */
+static void uiFrame(void* ctx) {
+    syncDeviceState();
+    UiQueue::drain();
+    pageManager->loop();
+    SoakTest::loop();
+}
 
 /**
  * @brief Arduino setup function. Initializes hardware and UI components.
@@ -59,6 +82,7 @@ void setup() {
     delay(2000);
     Serial.println("\n\n=== PoolNexus LVGL Demo ===");
     Serial.println("Starting initialization...");
+    MemoryPolicy::begin();
     display = new DisplayLVGL();
     if (!display->begin()) {
         while(1) {
@@ -77,46 +101,193 @@ void setup() {
         while(1) delay(100);
     }
     translator.setLanguage(Text::Language::FRENCH);
-    LanguagePageLVGL::setGlobalTranslator(&translator);
-    SettingsPageLVGL::setGlobalTranslator(&translator);
-    PumpPageLVGL::setGlobalTranslator(&translator);
-    CalibrationPHPageLVGL::setGlobalTranslator(&translator);
-    CalibrationRedoxPageLVGL::setGlobalTranslator(&translator);
-    CloudPageLVGL::setGlobalTranslator(&translator);
-    WiFiPageLVGL::setGlobalTranslator(&translator);
-    MQTTPageLVGL::setGlobalTranslator(&translator);
-    SwitchPageLVGL::setGlobalTranslator(&translator);
-    LevelProbePageLVGL::setGlobalTranslator(&translator);
-    PoolFillPageLVGL::setGlobalTranslator(&translator);
-    LockPageLVGL::setGlobalTranslator(&translator);
-    ScreenPageLVGL::setGlobalTranslator(&translator);
-    ResetPageLVGL::setGlobalTranslator(&translator);
-    pageManager = new PageManager();
+    uint32_t uiStart = micros();
+    uint32_t heapBefore = ESP.getFreeHeap();
+    UiStore::begin();
+    TextBindings::begin(&translator);
+    pageManager = new PageManager(&translator);
     pageManager->begin();
+    Notifications::begin(&translator);
+    UiQueue::begin(pageManager);
+    DeviceState::setPumpSpeed(50, DeviceWriter::CONTROL);
+    Serial.printf("UI ready in %lu us, heap used %lu bytes (free %lu)\n",
+                  (unsigned long)(micros() - uiStart),
+                  (unsigned long)(heapBefore - ESP.getFreeHeap()),
+                  (unsigned long)ESP.getFreeHeap());
+    // From here on, LVGL belongs to the UI task: take UiLock to reach it
+    if (!UiTask::begin(display, uiFrame, nullptr)) {
+        while(1) delay(100);
+    }
+}
+
+/**
+ * @brief Post a burst of toasts and dialogs and check that the pooled
+ * notifications did not take any LVGL memory.
+ */
+static void notificationBurst() {
+    lv_mem_monitor_t before;
+    LVGLArena::monitor(&before);
+
+    char message[32];
+    for (int i = 0; i < 20; i++) {
+        // Repeats of the same text are merged, the rest fill then overflow the queue
+        snprintf(message, sizeof(message), "Burst toast %d", i < 10 ? 0 : i);
+        Notifications::toast(message);
+    }
+    for (int i = 0; i < 5; i++) {
+        snprintf(message, sizeof(message), "Burst alert %d", i);
+        Notifications::alert("Test", message);
+    }
+
+    lv_mem_monitor_t after;
+    LVGLArena::monitor(&after);
+    Serial.printf("LVGL heap delta after burst: %ld bytes\n",
+                  (long)before.free_size - (long)after.free_size);
+    Notifications::printReport(Serial);
 }
 
 /**
- * @brief Arduino loop function. Updates LVGL and simulates sensor values.
+ * @brief Post a burst of messages from the loop task, as a sensor or network
+ * task would: values coalesce per key, toasts beyond the queue are dropped.
+ */
+static void queueBurst() {
+    char message[UiMessage::TEXT_LEN];
+    uint32_t accepted = 0;
+    for (int i = 0; i < 100; i++) {
+        accepted += UiQueue::postValue(UiKey::PH, 6.8f + (i % 10) / 10.0f);
+        accepted += UiQueue::postValue(UiKey::REDOX, 700 + i);
+    }
+    for (int i = 0; i < 40; i++) {
+        snprintf(message, sizeof(message), "Queue toast %d", i);
+        accepted += UiQueue::postToast(message);
+    }
+    Serial.printf("Queue burst: %lu/240 messages accepted\n", (unsigned long)accepted);
+}
+
+/**
+ * @brief Handle single-character diagnostic commands from the serial console.
+ *
+ * l : print touch-to-photon latency report
+ * L : reset latency statistics
+ * r : start/stop touch trace recording
+ * p : replay the trace at original speed, P : at 4x speed
+ * d : dump the trace as hex, u : upload a trace (paste a dump)
+ * c : print page cache statistics
+ * n : notification burst (toasts and dialogs), print LVGL heap delta
+ * s : print live value store statistics
+ * f : benchmark the fixed-point value formatter against snprintf
+ * t : switch to the next language in place, T : print text binding statistics
+ * a : print LVGL arena usage (per page high-water marks, fragmentation)
+ * m : print memory pool report (DMA, internal, PSRAM)
+ * z : steady-state test, fails on any heap allocation after warm-up
+ * k : start/stop the random navigation soak test, K : print its report
+ * x : print task load (UI task, loop task) and UI lock contention
+ * q : print UI queue statistics, Q : post a burst of messages without the lock
+ * e : print the device state snapshot and seqlock read retries (no lock)
+ *
+ * Commands run under the UI lock: the UI task waits while one runs
+ * (including a trace upload or the steady-state test).
+ */
+static void handleSerialCommand() {
+    if (!Serial.available()) return;
+    int command = Serial.read();
+    if (command == 'e') {
+        DeviceState::printReport(Serial);
+        return;
+    }
+    if (command == 'Q') {
+        queueBurst();
+        return;
+    }
+    UiLock lock;
+    switch (command) {
+        case 'l':
+            LatencyTracker::printReport(Serial);
+            break;
+        case 'L':
+            LatencyTracker::reset();
+            Serial.println("Latency statistics reset");
+            break;
+        case 'r':
+            if (touchLVGL->isRecording()) touchLVGL->stopRecording();
+            else touchLVGL->startRecording();
+            break;
+        case 'p':
+            touchLVGL->startReplay(100);
+            break;
+        case 'P':
+            touchLVGL->startReplay(400);
+            break;
+        case 'd':
+            touchLVGL->dumpTrace(Serial);
+            break;
+        case 'u':
+            Serial.println("Paste trace dump...");
+            touchLVGL->loadTrace(Serial);
+            break;
+        case 'c':
+            pageManager->printCacheReport(Serial);
+            break;
+        case 'n':
+            notificationBurst();
+            break;
+        case 's':
+            UiStore::printReport(Serial);
+            break;
+        case 'f':
+            benchmarkValueFormat(Serial, 10000);
+            break;
+        case 't': {
+            uint8_t next = (static_cast<uint8_t>(TextBindings::language()) + 1)
+                           % static_cast<uint8_t>(Text::Language::LANGUAGE_COUNT);
+            TextBindings::setLanguage(static_cast<Text::Language>(next));
+            break;
+        }
+        case 'T':
+            TextBindings::printReport(Serial);
+            break;
+        case 'a':
+            LVGLArena::printReport(Serial);
+            break;
+        case 'm':
+            MemoryPolicy::printReport(Serial);
+            break;
+        case 'z':
+            runSteadyStateTest(*pageManager, *display, Serial);
+            break;
+        case 'k':
+            if (SoakTest::running()) SoakTest::stop();
+            else SoakTest::start(pageManager);
+            break;
+        case 'K':
+            SoakTest::printReport(Serial);
+            break;
+        case 'x':
+            UiTask::printReport(Serial, &loopLoad);
+            break;
+        case 'q':
+            UiQueue::printReport(Serial);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Arduino loop function (loop task). Handles serial commands and
+ * simulates sensor values, published to the device state (no lock needed).
+ * Rendering runs in the UI task.
  */
 void loop() {
-    display->loop();
-    pageManager->loop();
+    loopLoad.begin();
+    MemoryPolicy::loop();
+    handleSerialCommand();
     static unsigned long lastUpdate = 0;
     if (millis() - lastUpdate > 2000) {
-        float ph = 7.0 + random(-5, 5) / 10.0;
-        float redox = 750 + random(-50, 50);
-        float temp = 24.5 + random(-10, 10) / 10.0;
-        Page* current = pageManager->getCurrentPage();
-        if (current) {
-            PageID currentId = static_cast<PageID>(pageManager->getCurrentPageId());
-            if (currentId == PageID::PAGE_MAIN_DISPLAY) {
-                auto mainDisplay = static_cast<MainDisplayPageLVGL*>(current);
-                if (mainDisplay) {
-                    mainDisplay->updateValues(ph, redox, temp);
-                }
-            }
-        }
+        DeviceState::setMeasurements(7.0 + random(-5, 5) / 10.0, 750 + random(-50, 50),
+                                     24.5 + random(-10, 10) / 10.0, DeviceWriter::SENSORS);
         lastUpdate = millis();
     }
-    delay(5);
+    loopLoad.end();
+    delay(10);
 }
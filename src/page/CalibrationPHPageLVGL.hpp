@@ -17,7 +17,7 @@
 
 class PageManager;
 
-class CalibrationPHPageLVGL : public LVGLPageBase, public Page {
+class CalibrationPHPageLVGL : public LVGLPageBase {
 private:
     static Text* globalTranslator;
     
@@ -28,9 +28,19 @@ private:
     
     float current_ph;
     
-    static void on_calibrate_low(lv_event_t* e);
-    static void on_calibrate_mid(lv_event_t* e);
-    static void on_calibrate_high(lv_event_t* e);
+    enum WidgetId : uint8_t {
+        W_CALIBRATE_LOW = 0,
+        W_CALIBRATE_MID,
+        W_CALIBRATE_HIGH
+    };
+    static const WidgetRoute<CalibrationPHPageLVGL> routes[];
+    
+    void on_calibrate_low(lv_obj_t* target);
+    void on_calibrate_mid(lv_obj_t* target);
+    void on_calibrate_high(lv_obj_t* target);
+    
+protected:
+    bool onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) override;
     
 public:
     CalibrationPHPageLVGL(PageManager* mgr = nullptr);
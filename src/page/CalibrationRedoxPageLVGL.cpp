@@ -16,13 +16,18 @@
 
 #include "CalibrationRedoxPageLVGL.hpp"
 #include "utils/interface-utils-lvgl.hpp"
+#include "utils/TextBindings.hpp"
 #include "../Translation/text.hpp"
 #include <Arduino.h>
 
 Text* CalibrationRedoxPageLVGL::globalTranslator = nullptr;
 
+const WidgetRoute<CalibrationRedoxPageLVGL> CalibrationRedoxPageLVGL::routes[] = {
+    { W_CALIBRATE, LV_EVENT_CLICKED, &CalibrationRedoxPageLVGL::on_calibrate }
+};
+
 CalibrationRedoxPageLVGL::CalibrationRedoxPageLVGL(PageManager* mgr) 
-    : LVGLPageBase("Calibration Redox", mgr),
+    : LVGLPageBase(StrId::SETTINGS_CALIBRATION_REDOX, mgr),
       btn_calibrate(nullptr), label_status(nullptr), current_redox(750.0) {
 }
 
@@ -34,36 +39,35 @@ void CalibrationRedoxPageLVGL::build(PageType type) {
         return;
     }
     
-    const char* title_text = globalTranslator ? 
-        Text::Settings::calibration_Redox(globalTranslator->getCurrentLanguage()) : 
-        "Calibration Redox";
+    const char* title_text = Text::get(globalTranslator, StrId::SETTINGS_CALIBRATION_REDOX);
     auto* title = createLabel(content_area, 0, 10, title_text, 
                              LVGLStyles::FONT_MEDIUM, LVGLStyles::COLOR_TEXT_PRIMARY);
+    TextBindings::bind(this, title, StrId::SETTINGS_CALIBRATION_REDOX);
     lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 0);
     
     lv_obj_t* card_redox = createCard(content_area, 20, 60, 420, 70);
-    const char* redox_label_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Redox actuel" : "Current Redox") : 
-        "Redox actuel";
+    const char* redox_label_text = Text::get(globalTranslator, StrId::CALIBRATION_CURRENT_REDOX);
     auto* label_redox = createLabel(card_redox, 20, 20, redox_label_text, 
                                    LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
+    TextBindings::bind(this, label_redox, StrId::CALIBRATION_CURRENT_REDOX);
     
     char redox_str[16];
-    snprintf(redox_str, sizeof(redox_str), "%.0f mV", current_redox);
+    formatValue<0>(redox_str, sizeof(redox_str), current_redox, Unit::MILLIVOLT);
     label_status = createLabel(card_redox, 300, 20, redox_str, 
                               LVGLStyles::FONT_LARGE, LVGLStyles::COLOR_INFO);
     
-    const char* calibrate_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Calibrer Redox" : "Calibrate Redox") : 
-        "Calibrer Redox";
+    const char* calibrate_text = Text::get(globalTranslator, StrId::CALIBRATION_CALIBRATE_REDOX);
     btn_calibrate = createButton(content_area, 150, 150, 180, 80, calibrate_text, 
                                 LVGLStyles::COLOR_PRIMARY);
-    lv_obj_add_event_cb(btn_calibrate, on_calibrate, LV_EVENT_CLICKED, this);
+    TextBindings::bind(this, lv_obj_get_child(btn_calibrate, 0), StrId::CALIBRATION_CALIBRATE_REDOX);
+    setWidgetId(btn_calibrate, W_CALIBRATE);
+}
+
+bool CalibrationRedoxPageLVGL::onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) {
+    return dispatchWidgetEvent(this, routes, id, code, target);
 }
 
-void CalibrationRedoxPageLVGL::on_calibrate(lv_event_t* e) {
-    CalibrationRedoxPageLVGL* page = (CalibrationRedoxPageLVGL*)e->user_data;
-    if (!page) return;
+void CalibrationRedoxPageLVGL::on_calibrate(lv_obj_t* target) {
     Serial.println("[CalibrationRedoxPageLVGL] Calibration Redox");
     // TODO: Implémenter la calibration
 }
@@ -17,7 +17,7 @@
 
 class PageManager;
 
-class CalibrationRedoxPageLVGL : public LVGLPageBase, public Page {
+class CalibrationRedoxPageLVGL : public LVGLPageBase {
 private:
     static Text* globalTranslator;
     
@@ -26,7 +26,15 @@ private:
     
     float current_redox;
     
-    static void on_calibrate(lv_event_t* e);
+    enum WidgetId : uint8_t {
+        W_CALIBRATE = 0
+    };
+    static const WidgetRoute<CalibrationRedoxPageLVGL> routes[];
+    
+    void on_calibrate(lv_obj_t* target);
+    
+protected:
+    bool onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) override;
     
 public:
     CalibrationRedoxPageLVGL(PageManager* mgr = nullptr);
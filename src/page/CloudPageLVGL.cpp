@@ -16,16 +16,21 @@
 
 #include "CloudPageLVGL.hpp"
 #include "utils/interface-utils-lvgl.hpp"
+#include "utils/TextBindings.hpp"
 #include "../Translation/text.hpp"
 #include <Arduino.h>
 
 Text* CloudPageLVGL::globalTranslator = nullptr;
 
+const WidgetRoute<CloudPageLVGL> CloudPageLVGL::routes[] = {
+    { W_ENABLE, LV_EVENT_VALUE_CHANGED, &CloudPageLVGL::on_switch_changed }
+};
+
 CloudPageLVGL::CloudPageLVGL(PageManager* mgr) 
-    : LVGLPageBase("Cloud", mgr),
+    : LVGLPageBase(StrId::SETTINGS_CLOUD, mgr),
       switch_enable(nullptr), label_enable(nullptr), 
       textarea_url(nullptr), label_url(nullptr),
-      cloudEnabled(false) {
+      cloudEnabled(false), saved_url{} {
 }
 
 void CloudPageLVGL::build(PageType type) {
@@ -36,35 +41,45 @@ void CloudPageLVGL::build(PageType type) {
         return;
     }
     
-    const char* title_text = globalTranslator ? 
-        Text::Settings::cloud(globalTranslator->getCurrentLanguage()) : 
-        "Cloud";
+    const char* title_text = Text::get(globalTranslator, StrId::SETTINGS_CLOUD);
     auto* title = createLabel(content_area, 0, 10, title_text, 
                              LVGLStyles::FONT_MEDIUM, LVGLStyles::COLOR_TEXT_PRIMARY);
+    TextBindings::bind(this, title, StrId::SETTINGS_CLOUD);
     lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 0);
     
     lv_obj_t* card_enable = createCard(content_area, 20, 60, 420, 70);
-    const char* enable_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Activer Cloud" : "Enable Cloud") : 
-        "Activer Cloud";
+    const char* enable_text = Text::get(globalTranslator, StrId::NETWORK_CLOUD_ENABLE);
     label_enable = createLabel(card_enable, 20, 20, enable_text, 
                               LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
+    TextBindings::bind(this, label_enable, StrId::NETWORK_CLOUD_ENABLE);
     switch_enable = createSwitch(card_enable, 350, 20, cloudEnabled);
-    lv_obj_add_event_cb(switch_enable, on_switch_changed, LV_EVENT_VALUE_CHANGED, this);
+    setWidgetId(switch_enable, W_ENABLE);
     
     lv_obj_t* card_url = createCard(content_area, 20, 150, 420, 100);
-    const char* url_label_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "URL du serveur" : "Server URL") : 
-        "URL du serveur";
+    const char* url_label_text = Text::get(globalTranslator, StrId::NETWORK_CLOUD_URL);
     label_url = createLabel(card_url, 20, 10, url_label_text, 
                            LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
-    textarea_url = createTextArea(card_url, 20, 35, 380, 50, "https://example.com/api");
+    TextBindings::bind(this, label_url, StrId::NETWORK_CLOUD_URL);
+    textarea_url = createTextArea(card_url, 20, 35, 380, 50, "https://example.com/api", InputMode::URL);
+}
+
+bool CloudPageLVGL::onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) {
+    return dispatchWidgetEvent(this, routes, id, code, target);
 }
 
-void CloudPageLVGL::on_switch_changed(lv_event_t* e) {
-    CloudPageLVGL* page = (CloudPageLVGL*)e->user_data;
-    if (!page) return;
-    page->cloudEnabled = lv_obj_has_state(page->switch_enable, LV_STATE_CHECKED);
-    Serial.printf("[CloudPageLVGL] Cloud %s\n", page->cloudEnabled ? "enabled" : "disabled");
+void CloudPageLVGL::on_switch_changed(lv_obj_t* target) {
+    cloudEnabled = lv_obj_has_state(switch_enable, LV_STATE_CHECKED);
+    Serial.printf("[CloudPageLVGL] Cloud %s\n", cloudEnabled ? "enabled" : "disabled");
 }
 
+void CloudPageLVGL::saveState() {
+    LVGLPageBase::saveState();
+    saveTextArea(textarea_url, saved_url, sizeof(saved_url));
+}
+
+void CloudPageLVGL::restoreState() {
+    if (hasSavedState) {
+        restoreTextArea(textarea_url, saved_url);
+    }
+    LVGLPageBase::restoreState();
+}
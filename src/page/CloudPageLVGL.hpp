@@ -17,7 +17,7 @@
 
 class PageManager;
 
-class CloudPageLVGL : public LVGLPageBase, public Page {
+class CloudPageLVGL : public LVGLPageBase {
 private:
     static Text* globalTranslator;
     
@@ -28,12 +28,24 @@ private:
     
     bool cloudEnabled;
     
-    static void on_switch_changed(lv_event_t* e);
+    char saved_url[128];
+    
+    enum WidgetId : uint8_t {
+        W_ENABLE = 0
+    };
+    static const WidgetRoute<CloudPageLVGL> routes[];
+    
+    void on_switch_changed(lv_obj_t* target);
+    
+protected:
+    bool onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) override;
     
 public:
     CloudPageLVGL(PageManager* mgr = nullptr);
     void build(PageType type = STANDARD) override;
     void show() override { LVGLPageBase::show(); }
+    void saveState() override;
+    void restoreState() override;
     void create() override {
         if (!screen) {
             build(STANDARD);
@@ -16,6 +16,7 @@
 
 #include "LanguagePageLVGL.hpp"
 #include "utils/interface-utils-lvgl.hpp"
+#include "utils/TextBindings.hpp"
 #include <Arduino.h>
 
 Text* LanguagePageLVGL::globalTranslator = nullptr;
@@ -25,8 +26,9 @@ void LanguagePageLVGL::build(PageType type) {
     
     if (!globalTranslator) return;
     
-    auto* label = createLabel(content_area, 0, 10, "Selection de la langue", 
+    auto* label = createLabel(content_area, 0, 10, Text::get(globalTranslator, StrId::LANGUAGE_TITLE), 
                               LVGLStyles::FONT_MEDIUM, LVGLStyles::COLOR_TEXT_PRIMARY);
+    TextBindings::bind(this, label, StrId::LANGUAGE_TITLE);
     lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 0);
     
     int y_offset = 60;
@@ -35,14 +37,13 @@ void LanguagePageLVGL::build(PageType type) {
         
         lv_obj_t* btn = createCard(content_area, 20, y_offset, 400, 60);
         lv_obj_add_flag(btn, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_set_user_data(btn, (void*)(intptr_t)lang);
-        lv_obj_add_event_cb(btn, on_language_clicked, LV_EVENT_CLICKED, this);
+        setWidgetId(btn, i);
         
         auto* lang_label = createLabel(btn, 20, 20, globalTranslator->getLanguageName(lang),
                                        LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
         
         if (globalTranslator->getCurrentLanguage() == lang) {
-            lv_obj_set_style_border_color(btn, lv_color_hex(LVGLStyles::COLOR_PRIMARY), 0);
+            lv_obj_set_style_border_color(btn, LVGLStyles::color(LVGLStyles::COLOR_PRIMARY), 0);
             lv_obj_set_style_border_width(btn, 3, 0);
         }
         
@@ -50,15 +51,18 @@ void LanguagePageLVGL::build(PageType type) {
     }
 }
 
-void LanguagePageLVGL::on_language_clicked(lv_event_t* e) {
-    LanguagePageLVGL* page = (LanguagePageLVGL*)e->user_data;
-    lv_obj_t* card = lv_event_get_target(e);
-    
+bool LanguagePageLVGL::onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) {
+    if (code != LV_EVENT_CLICKED || id >= static_cast<uint8_t>(Text::Language::LANGUAGE_COUNT)) return false;
+    on_language_clicked(target);
+    return true;
+}
+
+void LanguagePageLVGL::on_language_clicked(lv_obj_t* card) {
     if (!globalTranslator) return;
     
-    Text::Language selected = (Text::Language)(intptr_t)lv_obj_get_user_data(card);
+    Text::Language selected = static_cast<Text::Language>(widgetId(card));
     
-    globalTranslator->setLanguage(selected);
+    TextBindings::setLanguage(selected);
     
     Serial.printf("Langue changée: %s\n", globalTranslator->getLanguageName(selected));
     
@@ -70,8 +74,6 @@ void LanguagePageLVGL::on_language_clicked(lv_event_t* e) {
         }
     }
     
-    lv_obj_set_style_border_color(card, lv_color_hex(LVGLStyles::COLOR_PRIMARY), 0);
+    lv_obj_set_style_border_color(card, LVGLStyles::color(LVGLStyles::COLOR_PRIMARY), 0);
     lv_obj_set_style_border_width(card, 3, 0);
-    
-    // TODO: Déclencher un rafraîchissement de l'interface pour mettre à jour tous les textes
 }
@@ -17,19 +17,26 @@
 
 class PageManager;
 
-class LanguagePageLVGL : public LVGLPageBase, public Page {
+class LanguagePageLVGL : public LVGLPageBase {
 private:
     static Text* globalTranslator;
-    static void on_language_clicked(lv_event_t* e);
+    // Widget ID of a language card = its Text::Language value
+    void on_language_clicked(lv_obj_t* target);
+protected:
+    bool onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) override;
 public:
-    LanguagePageLVGL(PageManager* mgr = nullptr) : LVGLPageBase("Language Settings", mgr) {}
+    LanguagePageLVGL(PageManager* mgr = nullptr) : LVGLPageBase(StrId::SETTINGS_LANGUAGE, mgr) {}
 
     void build(PageType type = STANDARD) override;
     static void setGlobalTranslator(Text* translator) {
         globalTranslator = translator;
     }
     void show() override { LVGLPageBase::show(); }
-    void create() override {}
+    void create() override {
+        if (!screen) {
+            build(STANDARD);
+        }
+    }
 };
 
 #endif
@@ -16,84 +16,115 @@
 
 #include "MQTTPageLVGL.hpp"
 #include "utils/interface-utils-lvgl.hpp"
+#include "utils/TextBindings.hpp"
 #include "../Translation/text.hpp"
 #include <Arduino.h>
 
 Text* MQTTPageLVGL::globalTranslator = nullptr;
 
+const WidgetRoute<MQTTPageLVGL> MQTTPageLVGL::routes[] = {
+    { W_ENABLE, LV_EVENT_VALUE_CHANGED, &MQTTPageLVGL::on_switch_changed },
+    { W_TEST, LV_EVENT_CLICKED, &MQTTPageLVGL::on_test }
+};
+
 MQTTPageLVGL::MQTTPageLVGL(PageManager* mgr) 
-    : LVGLPageBase("MQTT", mgr),
+    : LVGLPageBase(StrId::SETTINGS_MQTT, mgr),
       switch_enable(nullptr), label_enable(nullptr),
       textarea_broker(nullptr), label_broker(nullptr),
       textarea_port(nullptr), label_port(nullptr),
       textarea_topic(nullptr), label_topic(nullptr),
       btn_test(nullptr),
-      mqttEnabled(false) {
+      mqttEnabled(false), saved_broker{}, saved_port{}, saved_topic{} {
 }
 
-void MQTTPageLVGL::build(PageType type) {
-    LVGLPageBase::build(type);
-    
+/**
+ * @brief Builds one card of the page per call, see LVGLPageBase::buildStep().
+ */
+void MQTTPageLVGL::buildPart(int part) {
     if (!content_area) {
         Serial.println("[MQTTPageLVGL] ERROR: content_area is NULL!");
         return;
     }
     
-    auto* title = createLabel(content_area, 0, 10, "MQTT", 
-                             LVGLStyles::FONT_MEDIUM, LVGLStyles::COLOR_TEXT_PRIMARY);
-    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 0);
-    
-    lv_obj_t* card_enable = createCard(content_area, 20, 60, 420, 70);
-    const char* enable_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Activer MQTT" : "Enable MQTT") : 
-        "Activer MQTT";
-    label_enable = createLabel(card_enable, 20, 20, enable_text, 
-                              LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
-    switch_enable = createSwitch(card_enable, 350, 20, mqttEnabled);
-    lv_obj_add_event_cb(switch_enable, on_switch_changed, LV_EVENT_VALUE_CHANGED, this);
-    
-    lv_obj_t* card_broker = createCard(content_area, 20, 150, 420, 80);
-    const char* broker_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Serveur MQTT" : "MQTT Server") : 
-        "Serveur MQTT";
-    label_broker = createLabel(card_broker, 20, 10, broker_text, 
-                              LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
-    textarea_broker = createTextArea(card_broker, 20, 35, 380, 35, "mqtt.example.com");
-    
-    lv_obj_t* card_port = createCard(content_area, 20, 250, 200, 80);
-    const char* port_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Port" : "Port") : 
-        "Port";
-    label_port = createLabel(card_port, 20, 10, port_text, 
-                            LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
-    textarea_port = createTextArea(card_port, 20, 35, 160, 35, "1883");
-    
-    lv_obj_t* card_topic = createCard(content_area, 240, 250, 200, 80);
-    const char* topic_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Topic" : "Topic") : 
-        "Topic";
-    label_topic = createLabel(card_topic, 20, 10, topic_text, 
-                             LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
-    textarea_topic = createTextArea(card_topic, 20, 35, 160, 35, "poolnexus/data");
-    
-    const char* test_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Tester connexion" : "Test connection") : 
-        "Tester connexion";
-    btn_test = createButton(content_area, 150, 350, 180, 50, test_text, 
-                           LVGLStyles::COLOR_INFO);
-    lv_obj_add_event_cb(btn_test, on_test, LV_EVENT_CLICKED, this);
+    switch (part) {
+        case 0: {
+            auto* title = createLabel(content_area, 0, 10, Text::get(globalTranslator, StrId::SETTINGS_MQTT), 
+                                     LVGLStyles::FONT_MEDIUM, LVGLStyles::COLOR_TEXT_PRIMARY);
+            TextBindings::bind(this, title, StrId::SETTINGS_MQTT);
+            lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 0);
+
+            lv_obj_t* card_enable = createCard(content_area, 20, 60, 420, 70);
+            const char* enable_text = Text::get(globalTranslator, StrId::NETWORK_MQTT_ENABLE);
+            label_enable = createLabel(card_enable, 20, 20, enable_text, 
+                                      LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
+            TextBindings::bind(this, label_enable, StrId::NETWORK_MQTT_ENABLE);
+            switch_enable = createSwitch(card_enable, 350, 20, mqttEnabled);
+            setWidgetId(switch_enable, W_ENABLE);
+            break;
+        }
+        case 1: {
+            lv_obj_t* card_broker = createCard(content_area, 20, 150, 420, 80);
+            const char* broker_text = Text::get(globalTranslator, StrId::NETWORK_MQTT_SERVER);
+            label_broker = createLabel(card_broker, 20, 10, broker_text, 
+                                      LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
+            TextBindings::bind(this, label_broker, StrId::NETWORK_MQTT_SERVER);
+            textarea_broker = createTextArea(card_broker, 20, 35, 380, 35, "mqtt.example.com", InputMode::URL);
+            break;
+        }
+        case 2: {
+            lv_obj_t* card_port = createCard(content_area, 20, 250, 200, 80);
+            const char* port_text = Text::get(globalTranslator, StrId::NETWORK_MQTT_PORT);
+            label_port = createLabel(card_port, 20, 10, port_text, 
+                                    LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
+            TextBindings::bind(this, label_port, StrId::NETWORK_MQTT_PORT);
+            textarea_port = createTextArea(card_port, 20, 35, 160, 35, "1883", InputMode::NUMBER);
+            break;
+        }
+        case 3: {
+            lv_obj_t* card_topic = createCard(content_area, 240, 250, 200, 80);
+            const char* topic_text = Text::get(globalTranslator, StrId::NETWORK_MQTT_TOPIC);
+            label_topic = createLabel(card_topic, 20, 10, topic_text, 
+                                     LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
+            TextBindings::bind(this, label_topic, StrId::NETWORK_MQTT_TOPIC);
+            textarea_topic = createTextArea(card_topic, 20, 35, 160, 35, "poolnexus/data");
+            break;
+        }
+        case 4: {
+            const char* test_text = Text::get(globalTranslator, StrId::NETWORK_MQTT_TEST);
+            btn_test = createButton(content_area, 150, 350, 180, 50, test_text, 
+                                   LVGLStyles::COLOR_INFO);
+            TextBindings::bind(this, lv_obj_get_child(btn_test, 0), StrId::NETWORK_MQTT_TEST);
+            setWidgetId(btn_test, W_TEST);
+            break;
+        }
+    }
+}
+
+bool MQTTPageLVGL::onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) {
+    return dispatchWidgetEvent(this, routes, id, code, target);
 }
 
-void MQTTPageLVGL::on_switch_changed(lv_event_t* e) {
-    MQTTPageLVGL* page = (MQTTPageLVGL*)e->user_data;
-    if (!page) return;
-    page->mqttEnabled = lv_obj_has_state(page->switch_enable, LV_STATE_CHECKED);
-    Serial.printf("[MQTTPageLVGL] MQTT %s\n", page->mqttEnabled ? "enabled" : "disabled");
+void MQTTPageLVGL::on_switch_changed(lv_obj_t* target) {
+    mqttEnabled = lv_obj_has_state(switch_enable, LV_STATE_CHECKED);
+    Serial.printf("[MQTTPageLVGL] MQTT %s\n", mqttEnabled ? "enabled" : "disabled");
 }
 
-void MQTTPageLVGL::on_test(lv_event_t* e) {
-    MQTTPageLVGL* page = (MQTTPageLVGL*)e->user_data;
-    if (!page) return;
+void MQTTPageLVGL::on_test(lv_obj_t* target) {
     Serial.println("[MQTTPageLVGL] Test de connexion MQTT");
 }
 
+void MQTTPageLVGL::saveState() {
+    LVGLPageBase::saveState();
+    saveTextArea(textarea_broker, saved_broker, sizeof(saved_broker));
+    saveTextArea(textarea_port, saved_port, sizeof(saved_port));
+    saveTextArea(textarea_topic, saved_topic, sizeof(saved_topic));
+}
+
+void MQTTPageLVGL::restoreState() {
+    if (hasSavedState) {
+        restoreTextArea(textarea_broker, saved_broker);
+        restoreTextArea(textarea_port, saved_port);
+        restoreTextArea(textarea_topic, saved_topic);
+    }
+    LVGLPageBase::restoreState();
+}
@@ -18,7 +18,7 @@
 
 class PageManager;
 
-class MQTTPageLVGL : public LVGLPageBase, public Page {
+class MQTTPageLVGL : public LVGLPageBase {
 private:
     static Text* globalTranslator;
     
@@ -34,15 +34,31 @@ private:
     
     bool mqttEnabled;
     
-    static void on_switch_changed(lv_event_t* e);
-    static void on_test(lv_event_t* e);
+    char saved_broker[64];
+    char saved_port[8];
+    char saved_topic[64];
+    
+    enum WidgetId : uint8_t {
+        W_ENABLE = 0,
+        W_TEST
+    };
+    static const WidgetRoute<MQTTPageLVGL> routes[];
+    
+    void on_switch_changed(lv_obj_t* target);
+    void on_test(lv_obj_t* target);
+    
+protected:
+    bool onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) override;
+    int buildPartCount() const override { return 5; }
+    void buildPart(int part) override;
     
 public:
     MQTTPageLVGL(PageManager* mgr = nullptr);
-    void build(PageType type = STANDARD) override;
     void show() override { LVGLPageBase::show(); }
+    void saveState() override;
+    void restoreState() override;
     void create() override {
-        if (!screen) {
+        if (!isCreated()) {
             build(STANDARD);
         }
     }
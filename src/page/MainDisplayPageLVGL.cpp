@@ -16,27 +16,35 @@
 
 #include "MainDisplayPageLVGL.hpp"
 #include "utils/interface-utils-lvgl.hpp"
+#include "utils/DeviceState.hpp"
 #include <Arduino.h>
 #include <cstdio>
 #include "../Translation/text.hpp"
 
+const WidgetRoute<MainDisplayPageLVGL> MainDisplayPageLVGL::routes[] = {
+    { W_POWER, LV_EVENT_CLICKED, &MainDisplayPageLVGL::on_power_clicked },
+    { W_PUMP, LV_EVENT_CLICKED, &MainDisplayPageLVGL::on_pump_clicked },
+    { W_ALERT, LV_EVENT_CLICKED, &MainDisplayPageLVGL::on_alert_clicked },
+    { W_SETTINGS, LV_EVENT_CLICKED, &MainDisplayPageLVGL::on_settings_clicked }
+};
+
 MainDisplayPageLVGL::MainDisplayPageLVGL(PageManager* mgr)
     : pageManager(mgr), screen(nullptr), label_ph(nullptr), label_redox(nullptr), 
       label_temp(nullptr), btn_power(nullptr), btn_pump(nullptr), 
-      btn_alert(nullptr), btn_settings(nullptr), isPowerOn(false), isPumpOn(false), nextPage(0)
+      btn_alert(nullptr), btn_settings(nullptr), nextPage(0)
 {
 }
 
 
 MainDisplayPageLVGL::~MainDisplayPageLVGL() {
-    if (screen) {
-        lv_obj_del(screen);
-    }
+    destroy();
 }
 
 void MainDisplayPageLVGL::create() {
+    if (screen) return;
     screen = lv_obj_create(NULL);
-    lv_obj_set_style_bg_color(screen, lv_color_hex(LVGLStyles::COLOR_BACKGROUND), 0);
+    applyBgColor(screen, LVGLStyles::COLOR_BACKGROUND);
+    lv_obj_add_event_cb(screen, on_widget_event, LV_EVENT_CLICKED, this);
     
     lv_obj_t* card_ph = createMeasurementCard(screen, 10, 10, 140, 90, "pH", "7.2", 
                                      LVGLStyles::FONT_LARGE, LVGLStyles::COLOR_SUCCESS);
@@ -50,25 +58,28 @@ void MainDisplayPageLVGL::create() {
     label_ph = lv_obj_get_child(card_ph, 1);
     label_redox = lv_obj_get_child(card_redox, 1);
     label_temp = lv_obj_get_child(card_temp, 1);
+    UiStore::bindLabel(this, UiKey::PH, label_ph, Fmt::PH);
+    UiStore::bindLabel(this, UiKey::REDOX, label_redox, Fmt::REDOX);
+    UiStore::bindLabel(this, UiKey::TEMPERATURE, label_temp, Fmt::TEMPERATURE);
     
     lv_obj_t* graph_area = createCard(screen, 10, 110, 460, 120);
     lv_obj_t* graph_label = createLabel(graph_area, 0, 0, "Historique pH/Redox", 
                                          LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_SECONDARY);
     lv_obj_center(graph_label);
     
-    btn_power = createButton(screen, 10, 245, 100, 60, isPowerOn ? "POWER\nON" : "POWER\nOFF",
-                             isPowerOn ? LVGLStyles::COLOR_SUCCESS : LVGLStyles::COLOR_DANGER);
-    lv_obj_add_event_cb(btn_power, on_power_clicked, LV_EVENT_CLICKED, this);
+    btn_power = createButton(screen, 10, 245, 100, 60, "POWER\nOFF", LVGLStyles::COLOR_DANGER);
+    setWidgetId(btn_power, W_POWER);
+    UiStore::observe(this, UiKey::POWER_ON, on_power_changed, this);
     
-    btn_pump = createButton(screen, 130, 245, 100, 60, isPumpOn ? "PUMP\nON" : "PUMP\nOFF",
-                            isPumpOn ? LVGLStyles::COLOR_SUCCESS : 0x9E9E9E);
-    lv_obj_add_event_cb(btn_pump, on_pump_clicked, LV_EVENT_CLICKED, this);
+    btn_pump = createButton(screen, 130, 245, 100, 60, "PUMP\nOFF", 0x9E9E9E);
+    setWidgetId(btn_pump, W_PUMP);
+    UiStore::observe(this, UiKey::PUMP_ON, on_pump_changed, this);
     
     btn_alert = createButton(screen, 250, 245, 100, 60, "ALERT", LVGLStyles::COLOR_WARNING);
-    lv_obj_add_event_cb(btn_alert, on_alert_clicked, LV_EVENT_CLICKED, this);
+    setWidgetId(btn_alert, W_ALERT);
     
     btn_settings = createButton(screen, 370, 245, 100, 60, "SETTINGS", LVGLStyles::COLOR_PRIMARY);
-    lv_obj_add_event_cb(btn_settings, on_settings_clicked, LV_EVENT_CLICKED, this);
+    setWidgetId(btn_settings, W_SETTINGS);
 }
 
 void MainDisplayPageLVGL::show() {
@@ -80,65 +91,81 @@ void MainDisplayPageLVGL::show() {
     }
 }
 
-void MainDisplayPageLVGL::updateValues(float ph, float redox, float temp) {
-    char buf[32];
-    Serial.println("[MainDisplayPageLVGL] updateValues() appelé");
-    if (!label_ph || !label_redox || !label_temp) {
-        Serial.println("[MainDisplayPageLVGL] Un ou plusieurs labels sont NULL !");
-        return;
-    }
-    snprintf(buf, sizeof(buf), "%.1f", ph);
-    lv_label_set_text(label_ph, buf);
-    snprintf(buf, sizeof(buf), "%.0f mV", redox);
-    lv_label_set_text(label_redox, buf);
-    snprintf(buf, sizeof(buf), "%.1f°C", temp);
-    lv_label_set_text(label_temp, buf);
+void MainDisplayPageLVGL::destroy() {
+    if (!screen) return;
+    UiStore::unbind(this);
+    lv_obj_del(screen);
+    screen = nullptr;
+    label_ph = label_redox = label_temp = nullptr;
+    btn_power = btn_pump = btn_alert = btn_settings = nullptr;
+}
+
+/**
+ * @brief Single screen callback, button clicks bubble up here.
+ */
+void MainDisplayPageLVGL::on_widget_event(lv_event_t* e) {
+    auto* page = static_cast<MainDisplayPageLVGL*>(lv_event_get_user_data(e));
+    lv_obj_t* target = lv_event_get_target(e);
+    int id = widgetId(target);
+    if (!page || id < 0) return;
+    dispatchWidgetEvent(page, routes, (uint8_t)id, lv_event_get_code(e), target);
 }
 
-void MainDisplayPageLVGL::on_power_clicked(lv_event_t* e) {
+void MainDisplayPageLVGL::on_power_clicked(lv_obj_t* target) {
     Serial.println("\n*** POWER BUTTON CLICKED ***");
-    MainDisplayPageLVGL* page = (MainDisplayPageLVGL*)lv_event_get_user_data(e);
-    page->isPowerOn = !page->isPowerOn;
-    
+    bool on = DeviceState::togglePower(DeviceWriter::UI);
+    Serial.printf("Power: %s\n\n", on ? "ON" : "OFF");
+}
+
+void MainDisplayPageLVGL::on_pump_clicked(lv_obj_t* target) {
+    Serial.println("\n*** PUMP BUTTON CLICKED ***");
+    bool on = DeviceState::togglePump(DeviceWriter::UI);
+    Serial.printf("Pump: %s\n\n", on ? "ON" : "OFF");
+}
+
+/**
+ * @brief Store observer: repaints the POWER button.
+ */
+void MainDisplayPageLVGL::on_power_changed(void* ctx, UiKey key, float value) {
+    auto* page = static_cast<MainDisplayPageLVGL*>(ctx);
+    if (!page->btn_power) return;
+
     lv_obj_t* label = lv_obj_get_child(page->btn_power, 0);
-    if (page->isPowerOn) {
-        lv_obj_set_style_bg_color(page->btn_power, lv_color_hex(LVGLStyles::COLOR_SUCCESS), 0);
-        lv_label_set_text(label, "POWER\nON");
+    if (value != 0.0f) {
+        lv_obj_set_style_bg_color(page->btn_power, LVGLStyles::color(LVGLStyles::COLOR_SUCCESS), 0);
+        setLabelText(label, "POWER\nON");
     } else {
-        lv_obj_set_style_bg_color(page->btn_power, lv_color_hex(LVGLStyles::COLOR_DANGER), 0);
-        lv_label_set_text(label, "POWER\nOFF");
+        lv_obj_set_style_bg_color(page->btn_power, LVGLStyles::color(LVGLStyles::COLOR_DANGER), 0);
+        setLabelText(label, "POWER\nOFF");
     }
-    
-    Serial.printf("Power: %s\n\n", page->isPowerOn ? "ON" : "OFF");
 }
 
-void MainDisplayPageLVGL::on_pump_clicked(lv_event_t* e) {
-    Serial.println("\n*** PUMP BUTTON CLICKED ***");
-    MainDisplayPageLVGL* page = (MainDisplayPageLVGL*)lv_event_get_user_data(e);
-    page->isPumpOn = !page->isPumpOn;
-    
+/**
+ * @brief Store observer: repaints the PUMP button.
+ */
+void MainDisplayPageLVGL::on_pump_changed(void* ctx, UiKey key, float value) {
+    auto* page = static_cast<MainDisplayPageLVGL*>(ctx);
+    if (!page->btn_pump) return;
+
     lv_obj_t* label = lv_obj_get_child(page->btn_pump, 0);
-    if (page->isPumpOn) {
-        lv_obj_set_style_bg_color(page->btn_pump, lv_color_hex(LVGLStyles::COLOR_SUCCESS), 0);
-        lv_label_set_text(label, "PUMP\nON");
+    if (value != 0.0f) {
+        lv_obj_set_style_bg_color(page->btn_pump, LVGLStyles::color(LVGLStyles::COLOR_SUCCESS), 0);
+        setLabelText(label, "PUMP\nON");
     } else {
-        lv_obj_set_style_bg_color(page->btn_pump, lv_color_hex(0x9E9E9E), 0); // Gris
-        lv_label_set_text(label, "PUMP\nOFF");
+        lv_obj_set_style_bg_color(page->btn_pump, LVGLStyles::color(0x9E9E9E), 0); // Gris
+        setLabelText(label, "PUMP\nOFF");
     }
-    
-    Serial.printf("Pump: %s\n\n", page->isPumpOn ? "ON" : "OFF");
 }
 
-void MainDisplayPageLVGL::on_alert_clicked(lv_event_t* e) {
+void MainDisplayPageLVGL::on_alert_clicked(lv_obj_t* target) {
     Serial.println("\n*** ALERT BUTTON CLICKED ***\n");
     // TODO: Navigate to alert page
 }
 
-void MainDisplayPageLVGL::on_settings_clicked(lv_event_t* e) {
+void MainDisplayPageLVGL::on_settings_clicked(lv_obj_t* target) {
     Serial.println("\n*** SETTINGS BUTTON CLICKED ***");
 
-    MainDisplayPageLVGL* page = static_cast<MainDisplayPageLVGL*>(lv_event_get_user_data(e));
 
-    page->pageManager->navigateToPage(PageID::PAGE_SETTINGS);
+    pageManager->navigateToPage(PageID::PAGE_SETTINGS);
 }
 
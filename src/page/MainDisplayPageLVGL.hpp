@@ -21,6 +21,7 @@
 #include "utils/Page.hpp"
 #include "utils/LVGLPageBase.hpp"
 #include "utils/PageManager.hpp"
+#include "utils/UiStore.hpp"
 
 class MainDisplayPageLVGL : public Page {
 private:
@@ -35,14 +36,23 @@ private:
     lv_obj_t* btn_alert;
     lv_obj_t* btn_settings;
     
-    bool isPowerOn;
-    bool isPumpOn;
     int nextPage;
 
-    static void on_power_clicked(lv_event_t* e);
-    static void on_pump_clicked(lv_event_t* e);
-    static void on_alert_clicked(lv_event_t* e);
-    static void on_settings_clicked(lv_event_t* e);
+    enum WidgetId : uint8_t {
+        W_POWER = 0,
+        W_PUMP,
+        W_ALERT,
+        W_SETTINGS
+    };
+    static const WidgetRoute<MainDisplayPageLVGL> routes[];
+    
+    void on_power_clicked(lv_obj_t* target);
+    void on_pump_clicked(lv_obj_t* target);
+    void on_alert_clicked(lv_obj_t* target);
+    void on_settings_clicked(lv_obj_t* target);
+    static void on_widget_event(lv_event_t* e);
+    static void on_power_changed(void* ctx, UiKey key, float value);
+    static void on_pump_changed(void* ctx, UiKey key, float value);
 
 public:
     MainDisplayPageLVGL(PageManager* mgr);
@@ -50,7 +60,8 @@ public:
 
     void create();
     void show();
-    void updateValues(float ph, float redox, float temp);
+    void destroy() override;
+    bool isCreated() const override { return screen != nullptr; }
 };
 
 
@@ -17,28 +17,28 @@
 
 class PageManager;
 
-class PoolFillPageLVGL : public LVGLPageBase, public Page {
+class PoolFillPageLVGL : public LVGLPageBase {
 private:
     static Text* globalTranslator;
     
-    lv_obj_t* switch_auto;
-    lv_obj_t* label_auto;
-    lv_obj_t* slider_level;
-    lv_obj_t* label_level;
-    lv_obj_t* label_level_value;
+    enum Slot : uint8_t { SLOT_AUTO = 0, SLOT_LEVEL, SLOT_COUNT };
     
-    bool autoFillEnabled;
-    int fillLevel;
+    static const WidgetSpec layoutSpecs[];
+    int32_t values[SLOT_COUNT];
+    LayoutSlot slots[SLOT_COUNT];
+    LayoutBinding layout;
     
-    static void on_switch_changed(lv_event_t* e);
-    static void on_slider_changed(lv_event_t* e);
+    static void on_value_changed(void* owner, const WidgetSpec& spec, int32_t value);
+    
+protected:
+    int buildPartCount() const override { return layout.count; }
+    void buildPart(int part) override;
     
 public:
     PoolFillPageLVGL(PageManager* mgr = nullptr);
-    void build(PageType type = STANDARD) override;
     void show() override { LVGLPageBase::show(); }
     void create() override {
-        if (!screen) {
+        if (!isCreated()) {
             build(STANDARD);
         }
     }
@@ -16,77 +16,65 @@
 
 #include "PumpPageLVGL.hpp"
 #include "utils/interface-utils-lvgl.hpp"
+#include "utils/DeviceState.hpp"
 #include <Arduino.h>
 
 Text* PumpPageLVGL::globalTranslator = nullptr;
 
+constexpr WidgetSpec PumpPageLVGL::layoutSpecs[] = {
+    { WidgetKind::TITLE, 0, 10, StrId::SETTINGS_PUMP, 0, 0, 0, Fmt::NONE },
+    { WidgetKind::SWITCH, 20, 60, StrId::CONTROLS_PUMP_ENABLE, SLOT_ENABLED, 0, 1, Fmt::NONE },
+    { WidgetKind::SLIDER, 20, 150, StrId::CONTROLS_PUMP_SPEED, SLOT_SPEED, 0, 100, Fmt::PERCENT },
+};
+
 PumpPageLVGL::PumpPageLVGL(PageManager* mgr) 
-    : LVGLPageBase("Pompe", mgr),
-      switch_enable(nullptr), label_enable(nullptr), slider_speed(nullptr), 
-      label_speed(nullptr), label_speed_value(nullptr), pumpEnabled(false), pumpSpeed(50) {
+    : LVGLPageBase(StrId::SETTINGS_PUMP, mgr),
+      values{0, 0},
+      slots{},
+      layout{layoutSpecs, sizeof(layoutSpecs) / sizeof(layoutSpecs[0]), values, slots, this, on_value_changed} {
+    static_assert(layoutIsValid(layoutSpecs, SLOT_COUNT), "layout slot out of range");
+    layoutBinding = &layout;
 }
 
-void PumpPageLVGL::build(PageType type) {
-    if (!globalTranslator) {
-        Serial.println("[PumpPageLVGL] WARNING: globalTranslator is NULL!");
+/**
+ * @brief The slots are read from the device state before the first part,
+ * so a rebuilt page shows the pump as it is now.
+ */
+void PumpPageLVGL::buildPart(int part) {
+    if (part == 0) {
+        DeviceSnapshot state = DeviceState::read();
+        values[SLOT_ENABLED] = state.pumpOn;
+        values[SLOT_SPEED] = state.pumpSpeed;
     }
-    
-    LVGLPageBase::build(type);
-    
-    if (!content_area) {
-        Serial.println("[PumpPageLVGL] ERROR: content_area is NULL!");
-        return;
+    buildLayoutItem(content_area, &layout, part,
+                    globalTranslator ? globalTranslator->getCurrentLanguage() : Text::Language::FRENCH);
+    if (layoutSpecs[part].kind == WidgetKind::SWITCH) {
+        UiStore::observe(this, UiKey::PUMP_ON, on_pump_changed, this);
+    } else if (layoutSpecs[part].kind == WidgetKind::SLIDER) {
+        UiStore::observe(this, UiKey::PUMP_SPEED, on_pump_changed, this);
     }
-    
-    const char* title_text = globalTranslator ? Text::Settings::pump(globalTranslator->getCurrentLanguage()) : "Pompe";
-    auto* title = createLabel(content_area, 0, 10, title_text, 
-                             LVGLStyles::FONT_MEDIUM, LVGLStyles::COLOR_TEXT_PRIMARY);
-    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 0);
-    
-    lv_obj_t* card_enable = createCard(content_area, 20, 60, 420, 70);
-    
-    const char* enable_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Activer la pompe" : "Enable pump") : 
-        "Activer la pompe";
-    label_enable = createLabel(card_enable, 20, 20, enable_text, 
-                              LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
-    
-    switch_enable = createSwitch(card_enable, 350, 20, pumpEnabled);
-    lv_obj_add_event_cb(switch_enable, on_switch_changed, LV_EVENT_VALUE_CHANGED, this);
-    
-    lv_obj_t* card_speed = createCard(content_area, 20, 150, 420, 100);
-    
-    const char* speed_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Vitesse" : "Speed") : 
-        "Vitesse";
-    label_speed = createLabel(card_speed, 20, 10, speed_text, 
-                             LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
-    
-    slider_speed = createSlider(card_speed, 20, 40, 380, 0, 100, pumpSpeed);
-    lv_obj_add_event_cb(slider_speed, on_slider_changed, LV_EVENT_VALUE_CHANGED, this);
-    
-    char speed_str[16];
-    snprintf(speed_str, sizeof(speed_str), "%d%%", pumpSpeed);
-    label_speed_value = createLabel(card_speed, 350, 10, speed_str, 
-                                   LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_SECONDARY);
 }
 
-void PumpPageLVGL::on_switch_changed(lv_event_t* e) {
-    PumpPageLVGL* page = (PumpPageLVGL*)e->user_data;
-    if (!page) return;
-    
-    page->pumpEnabled = lv_obj_has_state(page->switch_enable, LV_STATE_CHECKED);
-    Serial.printf("[PumpPageLVGL] Pump %s\n", page->pumpEnabled ? "enabled" : "disabled");
+/**
+ * @brief Pump toggled or its speed changed by another writer (main page,
+ * control, network). The page's own changes come back equal and are skipped.
+ */
+void PumpPageLVGL::on_pump_changed(void* ctx, UiKey key, float value) {
+    PumpPageLVGL* self = static_cast<PumpPageLVGL*>(ctx);
+    uint8_t slot = key == UiKey::PUMP_ON ? SLOT_ENABLED : SLOT_SPEED;
+    int32_t v = key == UiKey::PUMP_ON ? (value != 0.0f) : (int32_t)value;
+    if (self->values[slot] != v) setLayoutValue(&self->layout, slot, v);
 }
 
-void PumpPageLVGL::on_slider_changed(lv_event_t* e) {
-    PumpPageLVGL* page = (PumpPageLVGL*)e->user_data;
-    if (!page || !page->label_speed_value) return;
-    
-    page->pumpSpeed = lv_slider_get_value(page->slider_speed);
-    char speed_str[16];
-    snprintf(speed_str, sizeof(speed_str), "%d%%", page->pumpSpeed);
-    lv_label_set_text(page->label_speed_value, speed_str);
-    Serial.printf("[PumpPageLVGL] Speed changed to %d%%\n", page->pumpSpeed);
+void PumpPageLVGL::on_value_changed(void* owner, const WidgetSpec& spec, int32_t value) {
+    switch (spec.slot) {
+        case SLOT_ENABLED:
+            DeviceState::setPump(value != 0, DeviceWriter::UI);
+            Serial.printf("[PumpPageLVGL] Pump %s\n", value ? "enabled" : "disabled");
+            break;
+        case SLOT_SPEED:
+            DeviceState::setPumpSpeed((uint8_t)value, DeviceWriter::UI);
+            Serial.printf("[PumpPageLVGL] Speed changed to %d%%\n", (int)value);
+            break;
+    }
 }
-
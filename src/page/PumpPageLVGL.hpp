@@ -13,32 +13,38 @@
 #define PUMP_PAGE_LVGL_HPP
 
 #include "utils/LVGLPageBase.hpp"
+#include "utils/UiStore.hpp"
 #include "../Translation/text.hpp"
 
 class PageManager;
 
-class PumpPageLVGL : public LVGLPageBase, public Page {
+class PumpPageLVGL : public LVGLPageBase {
 private:
     static Text* globalTranslator;
     
-    lv_obj_t* switch_enable;
-    lv_obj_t* label_enable;
-    lv_obj_t* slider_speed;
-    lv_obj_t* label_speed;
-    lv_obj_t* label_speed_value;
+    enum Slot : uint8_t { SLOT_ENABLED = 0, SLOT_SPEED, SLOT_COUNT };
     
-    bool pumpEnabled;
-    int pumpSpeed;
+    static const WidgetSpec layoutSpecs[];
+    int32_t values[SLOT_COUNT];
+    LayoutSlot slots[SLOT_COUNT];
+    LayoutBinding layout;
     
-    static void on_switch_changed(lv_event_t* e);
-    static void on_slider_changed(lv_event_t* e);
+    static void on_value_changed(void* owner, const WidgetSpec& spec, int32_t value);
+
+    /**
+     * @brief Observateur de UiKey::PUMP_ON et PUMP_SPEED (pompe changée ailleurs)
+     */
+    static void on_pump_changed(void* ctx, UiKey key, float value);
+    
+protected:
+    int buildPartCount() const override { return layout.count; }
+    void buildPart(int part) override;
     
 public:
     PumpPageLVGL(PageManager* mgr = nullptr);
-    void build(PageType type = STANDARD) override;
     void show() override { LVGLPageBase::show(); }
     void create() override {
-        if (!screen) {
+        if (!isCreated()) {
             build(STANDARD);
         }
     }
@@ -16,13 +16,19 @@
 
 #include "ResetPageLVGL.hpp"
 #include "utils/interface-utils-lvgl.hpp"
+#include "utils/TextBindings.hpp"
 #include "../Translation/text.hpp"
 #include <Arduino.h>
 
 Text* ResetPageLVGL::globalTranslator = nullptr;
 
+const WidgetRoute<ResetPageLVGL> ResetPageLVGL::routes[] = {
+    { W_RESET_SETTINGS, LV_EVENT_CLICKED, &ResetPageLVGL::on_reset_settings },
+    { W_RESET_ALL, LV_EVENT_CLICKED, &ResetPageLVGL::on_reset_all }
+};
+
 ResetPageLVGL::ResetPageLVGL(PageManager* mgr) 
-    : LVGLPageBase("Reinitialisation", mgr),
+    : LVGLPageBase(StrId::TITLE_RESET, mgr),
       btn_reset_settings(nullptr), btn_reset_all(nullptr) {
 }
 
@@ -34,51 +40,41 @@ void ResetPageLVGL::build(PageType type) {
         return;
     }
     
-    const char* title_text = globalTranslator ? 
-        Text::Settings::reset(globalTranslator->getCurrentLanguage()) : 
-        "Reinitialisation";
+    const char* title_text = Text::get(globalTranslator, StrId::SETTINGS_RESET);
     auto* title = createLabel(content_area, 0, 10, title_text, 
                              LVGLStyles::FONT_MEDIUM, LVGLStyles::COLOR_TEXT_PRIMARY);
+    TextBindings::bind(this, title, StrId::SETTINGS_RESET);
     lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 0);
     
-    const char* warning_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? 
-         "Attention: Ces actions sont irreversibles!" : 
-         "Warning: These actions are irreversible!") : 
-        "Attention: Ces actions sont irreversibles!";
+    const char* warning_text = Text::get(globalTranslator, StrId::RESET_WARNING);
     auto* warning = createLabel(content_area, 0, 60, warning_text, 
                                LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_WARNING);
+    TextBindings::bind(this, warning, StrId::RESET_WARNING);
     lv_obj_align(warning, LV_ALIGN_TOP_MID, 0, 0);
     
-    const char* reset_settings_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? 
-         "Reinitialiser\nles parametres" : 
-         "Reset\nSettings") : 
-        "Reinitialiser\nles parametres";
+    const char* reset_settings_text = Text::get(globalTranslator, StrId::RESET_SETTINGS);
     btn_reset_settings = createButton(content_area, 50, 120, 180, 100, reset_settings_text, 
                                      LVGLStyles::COLOR_WARNING);
-    lv_obj_add_event_cb(btn_reset_settings, on_reset_settings, LV_EVENT_CLICKED, this);
+    TextBindings::bind(this, lv_obj_get_child(btn_reset_settings, 0), StrId::RESET_SETTINGS);
+    setWidgetId(btn_reset_settings, W_RESET_SETTINGS);
     
-    const char* reset_all_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? 
-         "Reinitialiser\nTout" : 
-         "Reset\nEverything") : 
-        "Reinitialiser\nTout";
+    const char* reset_all_text = Text::get(globalTranslator, StrId::RESET_ALL);
     btn_reset_all = createButton(content_area, 250, 120, 180, 100, reset_all_text, 
                                 LVGLStyles::COLOR_DANGER);
-    lv_obj_add_event_cb(btn_reset_all, on_reset_all, LV_EVENT_CLICKED, this);
+    TextBindings::bind(this, lv_obj_get_child(btn_reset_all, 0), StrId::RESET_ALL);
+    setWidgetId(btn_reset_all, W_RESET_ALL);
+}
+
+bool ResetPageLVGL::onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) {
+    return dispatchWidgetEvent(this, routes, id, code, target);
 }
 
-void ResetPageLVGL::on_reset_settings(lv_event_t* e) {
-    ResetPageLVGL* page = (ResetPageLVGL*)e->user_data;
-    if (!page) return;
+void ResetPageLVGL::on_reset_settings(lv_obj_t* target) {
     Serial.println("[ResetPageLVGL] Reset settings requested");
     // TODO: Implémenter la réinitialisation des paramètres
 }
 
-void ResetPageLVGL::on_reset_all(lv_event_t* e) {
-    ResetPageLVGL* page = (ResetPageLVGL*)e->user_data;
-    if (!page) return;
+void ResetPageLVGL::on_reset_all(lv_obj_t* target) {
     Serial.println("[ResetPageLVGL] Reset all requested");
     // TODO: Implémenter la réinitialisation complète
 }
@@ -19,15 +19,24 @@
 // Forward declaration
 class PageManager;
 
-class ResetPageLVGL : public LVGLPageBase, public Page {
+class ResetPageLVGL : public LVGLPageBase {
 private:
     static Text* globalTranslator;
     
     lv_obj_t* btn_reset_settings;
     lv_obj_t* btn_reset_all;
     
-    static void on_reset_settings(lv_event_t* e);
-    static void on_reset_all(lv_event_t* e);
+    enum WidgetId : uint8_t {
+        W_RESET_SETTINGS = 0,
+        W_RESET_ALL
+    };
+    static const WidgetRoute<ResetPageLVGL> routes[];
+    
+    void on_reset_settings(lv_obj_t* target);
+    void on_reset_all(lv_obj_t* target);
+    
+protected:
+    bool onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) override;
     
 public:
     ResetPageLVGL(PageManager* mgr = nullptr);
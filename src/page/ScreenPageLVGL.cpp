@@ -16,83 +16,47 @@
 
 #include "ScreenPageLVGL.hpp"
 #include "utils/interface-utils-lvgl.hpp"
+#include "utils/PageManager.hpp"
 #include "../Translation/text.hpp"
 #include <Arduino.h>
 
 Text* ScreenPageLVGL::globalTranslator = nullptr;
 
-ScreenPageLVGL::ScreenPageLVGL(PageManager* mgr) 
-    : LVGLPageBase("Ecran", mgr),
-      slider_brightness(nullptr), label_brightness(nullptr), label_brightness_value(nullptr),
-      slider_timeout(nullptr), label_timeout(nullptr), label_timeout_value(nullptr),
-      brightness(80), screenTimeout(30) {
-}
+constexpr WidgetSpec ScreenPageLVGL::layoutSpecs[] = {
+    { WidgetKind::TITLE, 0, 10, StrId::SETTINGS_SCREEN, 0, 0, 0, Fmt::NONE },
+    { WidgetKind::SLIDER, 20, 60, StrId::CONTROLS_SCREEN_BRIGHTNESS, SLOT_BRIGHTNESS, 0, 100, Fmt::PERCENT },
+    { WidgetKind::SLIDER, 20, 180, StrId::CONTROLS_SCREEN_TIMEOUT, SLOT_TIMEOUT, 5, 300, Fmt::SECONDS },
+    { WidgetKind::BUTTON, 130, 300, StrId::CONTROLS_SCREEN_CALIBRATE_TOUCH, ACTION_CALIBRATE, 0, 0, Fmt::NONE },
+};
 
-void ScreenPageLVGL::build(PageType type) {
-    LVGLPageBase::build(type);
-    
-    if (!content_area) {
-        Serial.println("[ScreenPageLVGL] ERROR: content_area is NULL!");
-        return;
-    }
-    
-    // Titre
-    const char* title_text = globalTranslator ? 
-        Text::Settings::screen(globalTranslator->getCurrentLanguage()) : 
-        "Ecran";
-    auto* title = createLabel(content_area, 0, 10, title_text, 
-                             LVGLStyles::FONT_MEDIUM, LVGLStyles::COLOR_TEXT_PRIMARY);
-    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 0);
-    
-    // Carte pour la luminosité
-    lv_obj_t* card_brightness = createCard(content_area, 20, 60, 420, 100);
-    const char* brightness_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Luminosité (%)" : "Brightness (%)") : 
-        "Luminosité (%)";
-    label_brightness = createLabel(card_brightness, 20, 10, brightness_text, 
-                                  LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
-    slider_brightness = createSlider(card_brightness, 20, 40, 380, 0, 100, brightness);
-    lv_obj_add_event_cb(slider_brightness, on_brightness_changed, LV_EVENT_VALUE_CHANGED, this);
-    
-    char brightness_str[16];
-    snprintf(brightness_str, sizeof(brightness_str), "%d%%", brightness);
-    label_brightness_value = createLabel(card_brightness, 350, 10, brightness_str, 
-                                        LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_SECONDARY);
-    
-    // Carte pour le timeout d'écran
-    lv_obj_t* card_timeout = createCard(content_area, 20, 180, 420, 100);
-    const char* timeout_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Timeout écran (sec)" : "Screen timeout (sec)") : 
-        "Timeout écran (sec)";
-    label_timeout = createLabel(card_timeout, 20, 10, timeout_text, 
-                               LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
-    slider_timeout = createSlider(card_timeout, 20, 40, 380, 5, 300, screenTimeout);
-    lv_obj_add_event_cb(slider_timeout, on_timeout_changed, LV_EVENT_VALUE_CHANGED, this);
-    
-    char timeout_str[16];
-    snprintf(timeout_str, sizeof(timeout_str), "%d sec", screenTimeout);
-    label_timeout_value = createLabel(card_timeout, 350, 10, timeout_str, 
-                                     LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_SECONDARY);
+ScreenPageLVGL::ScreenPageLVGL(PageManager* mgr) 
+    : LVGLPageBase(StrId::SETTINGS_SCREEN, mgr),
+      values{80, 30},
+      slots{},
+      layout{layoutSpecs, sizeof(layoutSpecs) / sizeof(layoutSpecs[0]), values, slots, this, on_value_changed} {
+    static_assert(layoutIsValid(layoutSpecs, SLOT_COUNT), "layout slot out of range");
+    layoutBinding = &layout;
 }
 
-void ScreenPageLVGL::on_brightness_changed(lv_event_t* e) {
-    ScreenPageLVGL* page = (ScreenPageLVGL*)e->user_data;
-    if (!page || !page->label_brightness_value) return;
-    page->brightness = lv_slider_get_value(page->slider_brightness);
-    char brightness_str[16];
-    snprintf(brightness_str, sizeof(brightness_str), "%d%%", page->brightness);
-    lv_label_set_text(page->label_brightness_value, brightness_str);
-    Serial.printf("[ScreenPageLVGL] Brightness changed to %d%%\n", page->brightness);
-    // TODO: Appliquer la luminosité à l'écran
+void ScreenPageLVGL::buildPart(int part) {
+    buildLayoutItem(content_area, &layout, part,
+                    globalTranslator ? globalTranslator->getCurrentLanguage() : Text::Language::FRENCH);
 }
 
-void ScreenPageLVGL::on_timeout_changed(lv_event_t* e) {
-    ScreenPageLVGL* page = (ScreenPageLVGL*)e->user_data;
-    if (!page || !page->label_timeout_value) return;
-    page->screenTimeout = lv_slider_get_value(page->slider_timeout);
-    char timeout_str[16];
-    snprintf(timeout_str, sizeof(timeout_str), "%d sec", page->screenTimeout);
-    lv_label_set_text(page->label_timeout_value, timeout_str);
-    Serial.printf("[ScreenPageLVGL] Screen timeout changed to %d seconds\n", page->screenTimeout);
+void ScreenPageLVGL::on_value_changed(void* owner, const WidgetSpec& spec, int32_t value) {
+    auto* page = static_cast<ScreenPageLVGL*>(owner);
+    switch (spec.slot) {
+        case SLOT_BRIGHTNESS:
+            Serial.printf("[ScreenPageLVGL] Brightness changed to %d%%\n", (int)value);
+            // TODO: Appliquer la luminosité à l'écran
+            break;
+        case SLOT_TIMEOUT:
+            Serial.printf("[ScreenPageLVGL] Screen timeout changed to %d seconds\n", (int)value);
+            break;
+        case ACTION_CALIBRATE:
+            if (!page || !page->pageManager) return;
+            Serial.println("[ScreenPageLVGL] Touch calibration requested");
+            page->pageManager->navigateToPage(PageID::PAGE_TOUCH_CALIBRATION);
+            break;
+    }
 }
-
@@ -17,29 +17,28 @@
 
 class PageManager;
 
-class ScreenPageLVGL : public LVGLPageBase, public Page {
+class ScreenPageLVGL : public LVGLPageBase {
 private:
     static Text* globalTranslator;
     
-    lv_obj_t* slider_brightness;
-    lv_obj_t* label_brightness;
-    lv_obj_t* label_brightness_value;
-    lv_obj_t* slider_timeout;
-    lv_obj_t* label_timeout;
-    lv_obj_t* label_timeout_value;
+    enum Slot : uint8_t { SLOT_BRIGHTNESS = 0, SLOT_TIMEOUT, SLOT_COUNT, ACTION_CALIBRATE = SLOT_COUNT };
     
-    int brightness;
-    int screenTimeout;
+    static const WidgetSpec layoutSpecs[];
+    int32_t values[SLOT_COUNT];
+    LayoutSlot slots[SLOT_COUNT];
+    LayoutBinding layout;
     
-    static void on_brightness_changed(lv_event_t* e);
-    static void on_timeout_changed(lv_event_t* e);
+    static void on_value_changed(void* owner, const WidgetSpec& spec, int32_t value);
+    
+protected:
+    int buildPartCount() const override { return layout.count; }
+    void buildPart(int part) override;
     
 public:
     ScreenPageLVGL(PageManager* mgr = nullptr);
-    void build(PageType type = STANDARD) override;
     void show() override { LVGLPageBase::show(); }
     void create() override {
-        if (!screen) {
+        if (!isCreated()) {
             build(STANDARD);
         }
     }
@@ -17,6 +17,7 @@
 
 #include "SettingsPageLVGL.hpp"
 #include "utils/interface-utils-lvgl.hpp"
+#include "utils/TextBindings.hpp"
 #include "utils/Page.hpp"
 #include "utils/PageManager.hpp"
 #include "../Translation/text.hpp"
@@ -24,63 +25,79 @@
 
 Text* SettingsPageLVGL::globalTranslator = nullptr;
 
+static constexpr const char* VERSION_TEXT = "Version : 1.0.1";
+
+/**
+ * @brief Settings menu, three rows per page. The page count follows the table.
+ */
+constexpr MenuEntry SettingsPageLVGL::entries[] = {
+    { StrId::SETTINGS_PUMP, PAGE_PUMP },
+    { StrId::SETTINGS_CALIBRATION_REDOX, PAGE_CALIBRATION_REDOX },
+    { StrId::SETTINGS_CALIBRATION_PH, PAGE_CALIBRATION_PH },
+    { StrId::SETTINGS_SWITCH, PAGE_SWITCH },
+    { StrId::SETTINGS_POOL_FILL, PAGE_POOL_FILL },
+    { StrId::SETTINGS_MQTT, PAGE_MQTT },
+    { StrId::SETTINGS_PRODUCT_LEVEL, PAGE_LEVEL_PROBE },
+    { StrId::SETTINGS_LOCK_SCREEN, PAGE_LOCK },
+    { StrId::SETTINGS_SCREEN, PAGE_SCREEN },
+    { StrId::SETTINGS_LANGUAGE, PAGE_LANGUAGE },
+    { StrId::SETTINGS_CLOUD, PAGE_CLOUD },
+    { StrId::SETTINGS_WIFI, PAGE_WIFI },
+    { StrId::SETTINGS_RESET, PAGE_RESET }
+};
+
+const WidgetRoute<SettingsPageLVGL> SettingsPageLVGL::routes[] = {
+    { W_PREVIOUS, LV_EVENT_CLICKED, &SettingsPageLVGL::on_previous_clicked },
+    { W_NEXT, LV_EVENT_CLICKED, &SettingsPageLVGL::on_next_clicked },
+    { W_ROW_0, LV_EVENT_CLICKED, &SettingsPageLVGL::on_setting_clicked },
+    { W_ROW_1, LV_EVENT_CLICKED, &SettingsPageLVGL::on_setting_clicked },
+    { W_ROW_2, LV_EVENT_CLICKED, &SettingsPageLVGL::on_setting_clicked }
+};
+
 /**
  * @brief Constructor for SettingsPageLVGL.
  * @param mgr Optional PageManager pointer.
  */
 SettingsPageLVGL::SettingsPageLVGL(PageManager* mgr) 
-    : LVGLPageBase("Parametres", mgr), currentPage(0), pageManager(mgr) {
-
+    : LVGLPageBase(StrId::MAIN_SETTINGS, mgr), pageManager(mgr) {
+    menu.setEntries(entries, W_PREVIOUS);
 }
 
-void SettingsPageLVGL::build(PageType type) {
 /**
- * @brief Builds the settings page UI.
- * @param type Page type (default: STANDARD).
+ * @brief Builds one part of the settings page UI.
+ * @param part 0: navigation, 1: menu rows, 2: labels and first page.
  */
-    Serial.println("[SettingsPageLVGL] build() called");
-
-    LVGLPageBase::build(type);
-    
-    Serial.printf("[SettingsPageLVGL] After build: screen=%p, content_area=%p, backButton=%p\n", 
-                  screen, content_area, backButton);
-
+void SettingsPageLVGL::buildPart(int part) {
     if (!content_area) {
         Serial.println("[SettingsPageLVGL] ERROR: content_area is NULL after build!");
         return;
     }
-    
 
-    if (backButton) {
-        lv_obj_remove_event_cb_with_user_data(backButton, nullptr, this);
-        lv_obj_add_event_cb(backButton, on_back_clicked, LV_EVENT_CLICKED, this);
-    }
-
-    lv_obj_set_style_bg_opa(content_area, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(content_area, 0, 0);
-    lv_obj_set_style_shadow_width(content_area, 0, 0);
-    lv_obj_set_style_pad_all(content_area, 0, 0);
-    
-    lv_obj_set_scrollbar_mode(content_area, LV_SCROLLBAR_MODE_OFF);
-    lv_obj_set_scroll_dir(content_area, LV_DIR_VER);
-    lv_obj_set_scroll_snap_y(content_area, LV_SCROLL_SNAP_NONE);
-    
-    btn_previous = createButton(screen, 53, 260, 120, 50, "<", LVGLStyles::COLOR_TEXT_SECONDARY);
-    lv_obj_add_event_cb(btn_previous, on_previous_clicked, LV_EVENT_CLICKED, this);
-    
-    btn_next = createButton(screen, 307, 260, 120, 50, ">", LVGLStyles::COLOR_TEXT_SECONDARY);
-    lv_obj_add_event_cb(btn_next, on_next_clicked, LV_EVENT_CLICKED, this);
-    
-    page_indicator = createLabel(screen, 190, 275, "1/5", LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_SECONDARY);
-    
-    setupSettingRowsOnce();
-    
-    if (globalTranslator) {
-        drawPageContent();
-        updateNavigationButtons();
-    } else {
-        Serial.println("[SettingsPageLVGL] WARNING: globalTranslator is NULL, skipping drawPageContent()");
-        updateNavigationButtons();
+    switch (part) {
+        case 0:
+
+            lv_obj_set_style_bg_opa(content_area, LV_OPA_TRANSP, 0);
+            lv_obj_set_style_border_width(content_area, 0, 0);
+            lv_obj_set_style_shadow_width(content_area, 0, 0);
+            lv_obj_set_style_pad_all(content_area, 0, 0);
+            
+            lv_obj_set_scrollbar_mode(content_area, LV_SCROLLBAR_MODE_OFF);
+            lv_obj_clear_flag(content_area, LV_OBJ_FLAG_SCROLLABLE);
+            
+            menu.createNavigation(screen);
+            break;
+        case 1:
+            menu.createRows(content_area, VERSION_TEXT);
+            break;
+        case 2:
+            if (globalTranslator) {
+                menu.bindLanguage(globalTranslator->getCurrentLanguage());
+            } else {
+                Serial.println("[SettingsPageLVGL] WARNING: globalTranslator is NULL, menu labels not bound");
+            }
+            TextBindings::observe(this, on_language_changed, this);
+            menu.setPage(menu.page());
+            break;
     }
 }
 
@@ -99,248 +116,66 @@ void SettingsPageLVGL::hide() {
     // La page est cachée automatiquement quand une autre page est chargée
 }
 
-void SettingsPageLVGL::drawPageContent() {
 /**
- * @brief Draws the content for the current settings page.
+ * @brief Rebinds the menu rows in place when the language changes.
  */
-    if (!globalTranslator) {
-        Serial.println("[SettingsPageLVGL] ERROR: globalTranslator is NULL in drawPageContent()!");
-        return;
-    }
-    if (!content_area) {
-        Serial.println("[SettingsPageLVGL] ERROR: content_area is NULL in drawPageContent()!");
-        return;
-    }
-    if (!page_indicator) {
-        Serial.println("[SettingsPageLVGL] ERROR: page_indicator is NULL in drawPageContent()!");
-        return;
-    }
-    
-    struct SettingItem {
-        const char* text;
-        int pageId;
-    };
-    
-    const SettingItem items[5][3] = {
-        // Page 0
-        {{Text::Settings::pump(globalTranslator->getCurrentLanguage()), PAGE_PUMP}, 
-         {Text::Settings::calibration_Redox(globalTranslator->getCurrentLanguage()), PAGE_CALIBRATION_REDOX}, 
-         {Text::Settings::calibration_pH(globalTranslator->getCurrentLanguage()), PAGE_CALIBRATION_PH}},
-        
-        // Page 1
-        {{Text::Settings::switch_(globalTranslator->getCurrentLanguage()), PAGE_SWITCH}, 
-         {Text::Settings::pool_fill(globalTranslator->getCurrentLanguage()), PAGE_POOL_FILL}, 
-         {"MQTT", PAGE_MQTT}},
-        
-        // Page 2
-        {{Text::Settings::product_level(globalTranslator->getCurrentLanguage()), PAGE_LEVEL_PROBE}, 
-         {Text::Settings::lock_screen(globalTranslator->getCurrentLanguage()), PAGE_LOCK}, 
-         {Text::Settings::screen(globalTranslator->getCurrentLanguage()), PAGE_SCREEN}},
-        
-        // Page 3
-        {{Text::Settings::language(globalTranslator->getCurrentLanguage()), PAGE_LANGUAGE}, 
-         {Text::Settings::cloud(globalTranslator->getCurrentLanguage()), PAGE_CLOUD}, 
-         {Text::Settings::wifi(globalTranslator->getCurrentLanguage()), PAGE_WIFI}},
-        
-        // Page 4
-        {{Text::Settings::reset(globalTranslator->getCurrentLanguage()), PAGE_RESET}, 
-         {"", -1}, 
-         {"", -1}}
-    };
-    
-    for (int i = 0; i < 3; i++) {
-        const char* t = items[currentPage][i].text;
-        int id = items[currentPage][i].pageId;
-        setRow(i, t, id);
-    }
-    
-    if (currentPage == 4) {
-        lv_obj_t* version_label = createLabel(content_area, 0, 150, "Version : 1.0.1", 
-                                               LVGLStyles::FONT_SMALL, LVGLStyles::COLOR_TEXT_SECONDARY);
-        lv_obj_align(version_label, LV_ALIGN_BOTTOM_MID, 0, -10);
-    }
-    
-    if (page_indicator) {
-        char page_text[16];
-        snprintf(page_text, sizeof(page_text), "%d/%d", currentPage + 1, totalPages);
-        lv_label_set_text(page_indicator, page_text);
-    }
-}
-
-/**
- * @brief Creates a setting button for a given index and text.
- * @param index Button index.
- * @param text Button label.
- * @param pageId Associated page ID.
- */
-void SettingsPageLVGL::createSettingButton(int index, const char* text, int pageId) {
-    if (index < 0 || index >= 3) {
-        Serial.printf("[SettingsPageLVGL] ERROR: Invalid index %d in createSettingButton()\n", index);
-        return;
-    }
-    
-    if (!content_area) {
-        Serial.println("[SettingsPageLVGL] ERROR: content_area is NULL in createSettingButton()!");
-        return;
-    }
-    
-    int y_pos = index * 65;
-    setting_buttons[index] = createCard(content_area, 0, y_pos, 440, 60);
-    if (!setting_buttons[index]) {
-        Serial.printf("[SettingsPageLVGL] ERROR: Failed to create button[%d]\n", index);
-        return;
-    }
-    
-    lv_obj_add_flag(setting_buttons[index], LV_OBJ_FLAG_CLICKABLE);
-    
-    lv_obj_set_user_data(setting_buttons[index], (void*)(intptr_t)pageId);
-    
-    lv_obj_add_event_cb(setting_buttons[index], on_setting_clicked, LV_EVENT_CLICKED, this);
-
-    setting_labels[index] = createLabel(setting_buttons[index], 10, 20, text ? text : "", 
-                                        LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
-    if (!setting_labels[index]) {
-        Serial.printf("[SettingsPageLVGL] ERROR: Failed to create label[%d]\n", index);
-    }
-    setting_page_ids[index] = pageId;
-}
-
-/**
- * @brief Updates navigation buttons (previous/next).
- */
-void SettingsPageLVGL::updateNavigationButtons() {
-    if (!btn_previous || !btn_next || !page_indicator) {
-        Serial.println("[SettingsPageLVGL] ERROR: Navigation buttons are NULL in updateNavigationButtons()!");
-        return;
-    }
-    
-    if (currentPage > 0) {
-        lv_obj_set_style_bg_color(btn_previous, lv_color_hex(LVGLStyles::COLOR_PRIMARY), 0);
-        lv_obj_clear_state(btn_previous, LV_STATE_DISABLED);
-    } else {
-        lv_obj_set_style_bg_color(btn_previous, lv_color_hex(LVGLStyles::COLOR_TEXT_SECONDARY), 0);
-        lv_obj_add_state(btn_previous, LV_STATE_DISABLED);
-    }
-    
-    if (currentPage < totalPages - 1) {
-        lv_obj_set_style_bg_color(btn_next, lv_color_hex(LVGLStyles::COLOR_PRIMARY), 0);
-        lv_obj_clear_state(btn_next, LV_STATE_DISABLED);
-    } else {
-        lv_obj_set_style_bg_color(btn_next, lv_color_hex(LVGLStyles::COLOR_TEXT_SECONDARY), 0);
-        lv_obj_add_state(btn_next, LV_STATE_DISABLED);
-    }
+void SettingsPageLVGL::on_language_changed(void* ctx, Text::Language lang) {
+    static_cast<SettingsPageLVGL*>(ctx)->menu.bindLanguage(lang);
 }
 
 /**
  * @brief Navigates to the previous settings page.
  */
 void SettingsPageLVGL::previousPage() {
-    if (currentPage > 0) {
-        currentPage--;
-        drawPageContent();
-        updateNavigationButtons();
-    }
+    menu.previous();
 }
 
 /**
  * @brief Navigates to the next settings page.
  */
 void SettingsPageLVGL::nextPage() {
-    if (currentPage < totalPages - 1) {
-        currentPage++;
-        drawPageContent();
-        updateNavigationButtons();
-    }
+    menu.next();
 }
 
-/**
- * @brief Sets up setting rows (called once).
- */
-void SettingsPageLVGL::setupSettingRowsOnce() {
-    for (int i = 0; i < 3; i++) {
-        createSettingButton(i, "", -1);
-        lv_obj_add_flag(setting_buttons[i], LV_OBJ_FLAG_HIDDEN);
-    }
-}
-
-/**
- * @brief Sets a row with text and page ID.
- * @param index Row index.
- * @param text Row label.
- * @param pageId Associated page ID.
- */
-void SettingsPageLVGL::setRow(int index, const char* text, int pageId) {
-    if (index < 0 || index >= 3) {
-        Serial.printf("[SettingsPageLVGL] ERROR: Invalid index %d in setRow()\n", index);
-        return;
-    }
-    
-    if (!setting_buttons[index] || !setting_labels[index]) {
-        Serial.printf("[SettingsPageLVGL] ERROR: setting_buttons[%d] or setting_labels[%d] is NULL!\n", index, index);
-        return;
-    }
-    
-    if (!content_area) {
-        Serial.println("[SettingsPageLVGL] ERROR: content_area is NULL in setRow()!");
-        return;
-    }
-    
-    if (text && strlen(text) > 0) {
-        lv_label_set_text(setting_labels[index], text);
-        lv_obj_clear_flag(setting_buttons[index], LV_OBJ_FLAG_HIDDEN);
-        setting_page_ids[index] = pageId;
-        lv_obj_set_user_data(setting_buttons[index], (void*)(intptr_t)pageId);
-    } else {
-        lv_obj_add_flag(setting_buttons[index], LV_OBJ_FLAG_HIDDEN);
-        setting_page_ids[index] = -1;
-        lv_obj_set_user_data(setting_buttons[index], (void*)(intptr_t)-1);
-    }
-    lv_obj_scroll_to_y(content_area, 0, LV_ANIM_OFF);
+bool SettingsPageLVGL::onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) {
+    return dispatchWidgetEvent(this, routes, id, code, target);
 }
 
 /**
- * @brief Callback for previous button click.
- * @param e LVGL event.
+ * @brief Handler for previous button click.
+ * @param target Button.
  */
-void SettingsPageLVGL::on_previous_clicked(lv_event_t* e) {
-    SettingsPageLVGL* page = (SettingsPageLVGL*)e->user_data;
-    page->previousPage();
+void SettingsPageLVGL::on_previous_clicked(lv_obj_t* target) {
+    previousPage();
 }
 
 /**
- * @brief Callback for next button click.
- * @param e LVGL event.
+ * @brief Handler for next button click.
+ * @param target Button.
  */
-void SettingsPageLVGL::on_next_clicked(lv_event_t* e) {
-    SettingsPageLVGL* page = (SettingsPageLVGL*)e->user_data;
-    page->nextPage();
+void SettingsPageLVGL::on_next_clicked(lv_obj_t* target) {
+    nextPage();
 }
 
 /**
- * @brief Callback for setting button click.
- * @param e LVGL event.
+ * @brief Handler for setting row click, navigates to the row's page.
+ * @param target Row card.
  */
-void SettingsPageLVGL::on_setting_clicked(lv_event_t* e) {
-    SettingsPageLVGL* page = (SettingsPageLVGL*)e->user_data;
-    if (!page || !page->pageManager) return;
-    
-    lv_obj_t* btn = lv_event_get_target(e);
-    
-    int pageId = (int)(intptr_t)lv_obj_get_user_data(btn);
+void SettingsPageLVGL::on_setting_clicked(lv_obj_t* target) {
+    if (!pageManager) return;
     
+    int pageId = menu.targetOf(widgetId(target));
     if (pageId >= 0) {
         Serial.printf("[SettingsPageLVGL] Navigation vers page %d\n", pageId);
-        page->pageManager->navigateToPage(static_cast<PageID>(pageId));
+        pageManager->navigateToPage(static_cast<PageID>(pageId));
     }
 }
 
 /**
- * @brief Callback for back button click (returns to MainDisplay).
- * @param e LVGL event.
+ * @brief Back button returns to MainDisplay.
  */
-void SettingsPageLVGL::on_back_clicked(lv_event_t* e) {
-    SettingsPageLVGL* page = (SettingsPageLVGL*)e->user_data;
-    if (!page || !page->pageManager) return;
+void SettingsPageLVGL::onBack() {
+    if (!pageManager) return;
     
-    page->pageManager->navigateToPage(PageID::PAGE_MAIN_DISPLAY);
+    pageManager->navigateToPage(PageID::PAGE_MAIN_DISPLAY);
 }
@@ -11,7 +11,7 @@
 /* **************************************************************************** */
 /**
  * @file SettingsPageLVGL.hpp
- * @brief LVGL settings page with pagination (5 pages).
+ * @brief LVGL settings page: paginated menu of the settings pages.
  * @author PoolNexus Hardware Team
  * @date 2025
  */
@@ -21,80 +21,64 @@
 
 #include <lvgl.h>
 #include "utils/LVGLPageBase.hpp"
+#include "utils/PaginatedMenu.hpp"
 #include "../Translation/text.hpp"
 
 class PageManager;
 
-class SettingsPageLVGL : public LVGLPageBase, public Page {
+class SettingsPageLVGL : public LVGLPageBase {
 private:
     static Text* globalTranslator;
     PageManager* pageManager;
     
-    int currentPage;
-    const int totalPages = 5;
-    
-    lv_obj_t* btn_previous;
-    lv_obj_t* btn_next;
-    lv_obj_t* page_indicator;
-    
-    lv_obj_t* setting_buttons[3];
-    lv_obj_t* setting_labels[3];
-    int setting_page_ids[3];
-    
-    /**
-     * @brief Draws the content for the current settings page.
-     */
-    void drawPageContent();
+    PaginatedMenu menu;
 
-    /**
-     * @brief Updates navigation buttons (previous/next).
-     */
-    void updateNavigationButtons();
+    // Ids follow the menu layout (menu id base = W_PREVIOUS = 0)
+    enum WidgetId : uint8_t {
+        W_PREVIOUS = PaginatedMenu::ID_PREVIOUS,
+        W_NEXT = PaginatedMenu::ID_NEXT,
+        W_ROW_0 = PaginatedMenu::ID_ROW_0,
+        W_ROW_1,
+        W_ROW_2
+    };
+    static const MenuEntry entries[];
+    static const WidgetRoute<SettingsPageLVGL> routes[];
 
     /**
-     * @brief Creates a setting button for a given index and text.
-     * @param index Button index.
-     * @param text Button label.
-     * @param pageId Associated page ID.
+     * @brief Handler for previous button click.
+     * @param target Button.
      */
-    void createSettingButton(int index, const char* text, int pageId);
+    void on_previous_clicked(lv_obj_t* target);
 
     /**
-     * @brief Sets up setting rows (called once).
+     * @brief Handler for next button click.
+     * @param target Button.
      */
-    void setupSettingRowsOnce();
+    void on_next_clicked(lv_obj_t* target);
 
     /**
-     * @brief Sets a row with text and page ID.
-     * @param index Row index.
-     * @param text Row label.
-     * @param pageId Associated page ID.
+     * @brief Handler for setting row click.
+     * @param target Row card.
      */
-    void setRow(int index, const char* text, int pageId);
+    void on_setting_clicked(lv_obj_t* target);
 
     /**
-     * @brief Callback for previous button click.
-     * @param e LVGL event.
+     * @brief Language observer: rebinds the menu rows in place.
+     * @param ctx Settings page.
+     * @param lang New language.
      */
-    static void on_previous_clicked(lv_event_t* e);
+    static void on_language_changed(void* ctx, Text::Language lang);
 
-    /**
-     * @brief Callback for next button click.
-     * @param e LVGL event.
-     */
-    static void on_next_clicked(lv_event_t* e);
+protected:
+    bool onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) override;
 
     /**
-     * @brief Callback for setting button click.
-     * @param e LVGL event.
+     * @brief Back button returns to MainDisplay.
      */
-    static void on_setting_clicked(lv_event_t* e);
+    void onBack() override;
 
-    /**
-     * @brief Callback for back button click (returns to MainDisplay).
-     * @param e LVGL event.
-     */
-    static void on_back_clicked(lv_event_t* e);
+    int buildPartCount() const override { return 3; }
+    void buildPart(int part) override;
 
 public:
     /**
@@ -117,11 +101,6 @@ public:
         LVGLPageBase::setPageManager(mgr);
     }
 
-    /**
-     * @brief Builds the settings page UI.
-     * @param type Page type (default: STANDARD).
-     */
-    void build(PageType type = STANDARD) override;
 
     /**
      * @brief Shows the settings page.
@@ -149,7 +128,7 @@ public:
      * @brief Creates the settings page UI if not already created.
      */
     void create() override {
-        if (!screen) {
+        if (!isCreated()) {
             build(STANDARD);
         }
     }
@@ -22,33 +22,22 @@ class PageManager;
  * @class SwitchPageLVGL
  * @brief LVGL page for managing switches in the UI.
  */
-class SwitchPageLVGL : public LVGLPageBase, public Page {
+class SwitchPageLVGL : public LVGLPageBase {
 private:
     static Text* globalTranslator;
     
-    lv_obj_t* switch1;
-    lv_obj_t* switch2;
-    lv_obj_t* switch3;
+    enum Slot : uint8_t { SLOT_SWITCH1 = 0, SLOT_SWITCH2, SLOT_SWITCH3, SLOT_COUNT };
     
-    bool switch1_enabled;
-    bool switch2_enabled;
-    bool switch3_enabled;
+    static const WidgetSpec layoutSpecs[];
+    int32_t values[SLOT_COUNT];
+    LayoutSlot slots[SLOT_COUNT];
+    LayoutBinding layout;
     
-    /**
-     * @brief Callback for switch 1 state change.
-     * @param e LVGL event.
-     */
-    static void on_switch1_changed(lv_event_t* e);
-    /**
-     * @brief Callback for switch 2 state change.
-     * @param e LVGL event.
-     */
-    static void on_switch2_changed(lv_event_t* e);
-    /**
-     * @brief Callback for switch 3 state change.
-     * @param e LVGL event.
-     */
-    static void on_switch3_changed(lv_event_t* e);
+    static void on_value_changed(void* owner, const WidgetSpec& spec, int32_t value);
+    
+protected:
+    int buildPartCount() const override { return layout.count; }
+    void buildPart(int part) override;
     
 public:
     /**
@@ -56,11 +45,6 @@ public:
      * @param mgr Optional PageManager pointer.
      */
     SwitchPageLVGL(PageManager* mgr = nullptr);
-    /**
-     * @brief Builds the switch page UI.
-     * @param type Page type (default: STANDARD).
-     */
-    void build(PageType type = STANDARD) override;
     /**
      * @brief Shows the switch page.
      */
@@ -69,7 +53,7 @@ public:
      * @brief Creates the switch page UI if not already created.
      */
     void create() override {
-        if (!screen) {
+        if (!isCreated()) {
             build(STANDARD);
         }
     }
@@ -0,0 +1,169 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   TouchCalibrationPageLVGL.cpp                   :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 09:40:03 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 09:40:03 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file TouchCalibrationPageLVGL.cpp
+ * @brief Implementation of the touch calibration page.
+ *
+ * The user taps three crosshairs; the raw controller readings averaged over each
+ * press are fed to TouchCalibration, then the new matrix is applied and saved to NVS.
+ * Cancel, or no tap for IDLE_TIMEOUT_MS, returns to the screen settings unchanged.
+ */
+
+#include "TouchCalibrationPageLVGL.hpp"
+#include "utils/interface-utils-lvgl.hpp"
+#include "utils/TextBindings.hpp"
+#include "utils/PageManager.hpp"
+#include "../screen/LVGLTouchInput.hpp"
+#include <Arduino.h>
+
+Text* TouchCalibrationPageLVGL::globalTranslator = nullptr;
+
+// 10% margins, spread over the three corners of a large triangle
+const TouchCalibration::Point TouchCalibrationPageLVGL::targets[POINT_COUNT] = {
+    {48, 32}, {432, 160}, {96, 288}
+};
+
+TouchCalibrationPageLVGL::TouchCalibrationPageLVGL(PageManager* mgr)
+    : LVGLPageBase(StrId::TITLE_TOUCH_CALIBRATION, mgr, HOME),
+      target(nullptr), label_instructions(nullptr), idleTimer(nullptr),
+      step(0), sumX(0), sumY(0), sampleCount(0), rawPoints{} {
+}
+
+void TouchCalibrationPageLVGL::build(PageType type) {
+    LVGLPageBase::build(type);
+    if (!screen) return;
+
+    lv_obj_clear_flag(screen, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(screen, on_screen_event, LV_EVENT_ALL, this);
+
+    const char* text = Text::get(globalTranslator, StrId::CALIBRATION_TOUCH_INSTRUCTIONS);
+    label_instructions = createLabel(screen, 0, 0, text,
+                                     LVGLStyles::FONT_MEDIUM, LVGLStyles::COLOR_TEXT_PRIMARY);
+    TextBindings::bind(this, label_instructions, StrId::CALIBRATION_TOUCH_INSTRUCTIONS);
+    lv_obj_align(label_instructions, LV_ALIGN_CENTER, 0, -20);
+
+    // Clear of the three targets; its events bubble to the page as the back action
+    lv_obj_t* cancel = createButton(screen, 190, 250, 100, 50,
+                                    Text::get(globalTranslator, StrId::CALIBRATION_TOUCH_CANCEL),
+                                    LVGLStyles::COLOR_DANGER);
+    TextBindings::bind(this, lv_obj_get_child(cancel, 0), StrId::CALIBRATION_TOUCH_CANCEL);
+    setWidgetId(cancel, WIDGET_BACK);
+
+    target = lv_obj_create(screen);
+    lv_obj_set_size(target, TARGET_SIZE, TARGET_SIZE);
+    lv_obj_set_style_radius(target, TARGET_SIZE / 2, 0);
+    lv_obj_set_style_bg_opa(target, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_color(target, LVGLStyles::color(LVGLStyles::COLOR_DANGER), 0);
+    lv_obj_set_style_border_width(target, 3, 0);
+    lv_obj_clear_flag(target, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_clear_flag(target, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t* dot = lv_obj_create(target);
+    lv_obj_set_size(dot, 6, 6);
+    lv_obj_set_style_radius(dot, 3, 0);
+    lv_obj_set_style_bg_color(dot, LVGLStyles::color(LVGLStyles::COLOR_DANGER), 0);
+    lv_obj_set_style_border_width(dot, 0, 0);
+    lv_obj_clear_flag(dot, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_center(dot);
+}
+
+void TouchCalibrationPageLVGL::show() {
+    LVGLPageBase::show();
+    restart();
+    if (!idleTimer) idleTimer = lv_timer_create(on_idle_timeout, IDLE_TIMEOUT_MS, this);
+    lv_timer_reset(idleTimer);
+}
+
+void TouchCalibrationPageLVGL::onExit() {
+    if (idleTimer) {
+        lv_timer_del(idleTimer);
+        idleTimer = nullptr;
+    }
+}
+
+void TouchCalibrationPageLVGL::onBack() {
+    Serial.println("[TouchCalibrationPageLVGL] Cancelled, calibration unchanged");
+    if (pageManager) pageManager->navigateToPage(PageID::PAGE_SCREEN);
+}
+
+void TouchCalibrationPageLVGL::on_idle_timeout(lv_timer_t* timer) {
+    TouchCalibrationPageLVGL* page = (TouchCalibrationPageLVGL*)timer->user_data;
+    Serial.println("[TouchCalibrationPageLVGL] No tap, giving up");
+    page->onBack();
+}
+
+void TouchCalibrationPageLVGL::restart() {
+    step = 0;
+    sampleCount = 0;
+    moveTarget();
+}
+
+void TouchCalibrationPageLVGL::moveTarget() {
+    if (!target || step >= POINT_COUNT) return;
+    lv_obj_set_pos(target, targets[step].x - TARGET_SIZE / 2, targets[step].y - TARGET_SIZE / 2);
+    Serial.printf("[TouchCalibrationPageLVGL] Target %d/%d at (%ld,%ld)\n", step + 1, POINT_COUNT,
+                  (long)targets[step].x, (long)targets[step].y);
+}
+
+void TouchCalibrationPageLVGL::finish() {
+    LVGLTouchInput* input = LVGLTouchInput::getInstance();
+    TouchController* touch = input ? input->getTouchController() : nullptr;
+    if (!touch) return;
+
+    TouchCalibration cal;
+    if (cal.computeFromPoints(targets, rawPoints, touch->getRotation())) {
+        touch->setCalibration(cal);
+        cal.save();
+        cal.print();
+        if (pageManager) pageManager->navigateToPage(PageID::PAGE_SCREEN);
+    } else {
+        restart();
+    }
+}
+
+void TouchCalibrationPageLVGL::on_screen_event(lv_event_t* e) {
+    TouchCalibrationPageLVGL* page = (TouchCalibrationPageLVGL*)e->user_data;
+    // Only taps on the bare screen count, not the bubbled Cancel button events
+    if (!page || page->step >= POINT_COUNT || lv_event_get_target(e) != page->screen) return;
+
+    LVGLTouchInput* input = LVGLTouchInput::getInstance();
+    TouchController* touch = input ? input->getTouchController() : nullptr;
+    if (!touch) return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    if (code == LV_EVENT_PRESSED) {
+        if (page->idleTimer) lv_timer_reset(page->idleTimer);
+        page->sumX = 0;
+        page->sumY = 0;
+        page->sampleCount = 0;
+    }
+    if (code == LV_EVENT_PRESSED || code == LV_EVENT_PRESSING) {
+        uint16_t rawX, rawY;
+        touch->getLastRawPoint(rawX, rawY);
+        page->sumX += rawX;
+        page->sumY += rawY;
+        page->sampleCount++;
+    } else if (code == LV_EVENT_RELEASED && page->sampleCount > 0) {
+        TouchCalibration::Point& p = page->rawPoints[page->step];
+        p.x = page->sumX / page->sampleCount;
+        p.y = page->sumY / page->sampleCount;
+        Serial.printf("[TouchCalibrationPageLVGL] Point %d raw=(%ld,%ld) from %ld samples\n",
+                      page->step + 1, (long)p.x, (long)p.y, (long)page->sampleCount);
+        page->sampleCount = 0;
+        page->step++;
+        if (page->step >= POINT_COUNT) {
+            page->finish();
+        } else {
+            page->moveTarget();
+        }
+    }
+}
@@ -0,0 +1,75 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   TouchCalibrationPageLVGL.hpp                   :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 09:40:03 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 09:40:03 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file TouchCalibrationPageLVGL.hpp
+ * @brief Full-screen 3-point touch calibration routine.
+ */
+
+#ifndef TOUCH_CALIBRATION_PAGE_LVGL_HPP
+#define TOUCH_CALIBRATION_PAGE_LVGL_HPP
+
+#include "utils/LVGLPageBase.hpp"
+#include "../Translation/text.hpp"
+#include "../screen/TouchCalibration.hpp"
+
+class PageManager;
+
+class TouchCalibrationPageLVGL : public LVGLPageBase {
+private:
+    static Text* globalTranslator;
+    static constexpr int POINT_COUNT = 3;
+    static constexpr int TARGET_SIZE = 40;
+    // Without a tap for this long, the routine gives up (touch too far off to reach Cancel)
+    static constexpr uint32_t IDLE_TIMEOUT_MS = 20000;
+    static const TouchCalibration::Point targets[POINT_COUNT];
+
+    lv_obj_t* target;
+    lv_obj_t* label_instructions;
+    lv_timer_t* idleTimer;
+
+    int step;
+    int32_t sumX;
+    int32_t sumY;
+    int32_t sampleCount;
+    TouchCalibration::Point rawPoints[POINT_COUNT];
+
+    void restart();
+    void moveTarget();
+    void finish();
+
+    static void on_screen_event(lv_event_t* e);
+    static void on_idle_timeout(lv_timer_t* timer);
+
+protected:
+    /**
+     * @brief Cancel button: leaves without touching the current calibration.
+     */
+    void onBack() override;
+
+public:
+    TouchCalibrationPageLVGL(PageManager* mgr = nullptr);
+    void build(PageType type = HOME) override;
+    void show() override;
+    void create() override {
+        if (!screen) {
+            build(HOME);
+        }
+    }
+    void onEnter() override { step = 0; }
+    void onExit() override;
+
+    static void setGlobalTranslator(Text* translator) {
+        globalTranslator = translator;
+    }
+};
+
+#endif
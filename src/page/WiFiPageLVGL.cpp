@@ -16,80 +16,190 @@
 
 #include "WiFiPageLVGL.hpp"
 #include "utils/interface-utils-lvgl.hpp"
+#include "utils/TextBindings.hpp"
 #include "../Translation/text.hpp"
 #include <Arduino.h>
+#include <WiFi.h>
 
 Text* WiFiPageLVGL::globalTranslator = nullptr;
 
+const WidgetRoute<WiFiPageLVGL> WiFiPageLVGL::routes[] = {
+    { W_ENABLE, LV_EVENT_VALUE_CHANGED, &WiFiPageLVGL::on_switch_changed },
+    { W_CONNECT, LV_EVENT_CLICKED, &WiFiPageLVGL::on_connect }
+};
+
 WiFiPageLVGL::WiFiPageLVGL(PageManager* mgr) 
-    : LVGLPageBase("WiFi", mgr),
+    : LVGLPageBase(StrId::SETTINGS_WIFI, mgr),
       switch_enable(nullptr), label_enable(nullptr),
       textarea_ssid(nullptr), label_ssid(nullptr),
       textarea_password(nullptr), label_password(nullptr),
-      btn_connect(nullptr),
-      wifiEnabled(false) {
+      btn_connect(nullptr), scanTimer(nullptr),
+      wifiEnabled(false), networks{}, networkCount(0),
+      saved_ssid{}, saved_password{} {
 }
 
-void WiFiPageLVGL::build(PageType type) {
-    LVGLPageBase::build(type);
-    
+/**
+ * @brief Builds one card of the page per call, see LVGLPageBase::buildStep().
+ */
+void WiFiPageLVGL::buildPart(int part) {
     if (!content_area) {
         Serial.println("[WiFiPageLVGL] ERROR: content_area is NULL!");
         return;
     }
     
-    const char* title_text = globalTranslator ? 
-        Text::Settings::wifi(globalTranslator->getCurrentLanguage()) : 
-        "WiFi";
-    auto* title = createLabel(content_area, 0, 10, title_text, 
-                             LVGLStyles::FONT_MEDIUM, LVGLStyles::COLOR_TEXT_PRIMARY);
-    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 0);
-    
-    lv_obj_t* card_enable = createCard(content_area, 20, 60, 420, 70);
-    const char* enable_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Activer WiFi" : "Enable WiFi") : 
-        "Activer WiFi";
-    label_enable = createLabel(card_enable, 20, 20, enable_text, 
-                              LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
-    switch_enable = createSwitch(card_enable, 350, 20, wifiEnabled);
-    lv_obj_add_event_cb(switch_enable, on_switch_changed, LV_EVENT_VALUE_CHANGED, this);
-    
-    lv_obj_t* card_ssid = createCard(content_area, 20, 150, 420, 80);
-    const char* ssid_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Nom du réseau (SSID)" : "Network name (SSID)") : 
-        "Nom du réseau (SSID)";
-    label_ssid = createLabel(card_ssid, 20, 10, ssid_text, 
-                            LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
-    textarea_ssid = createTextArea(card_ssid, 20, 35, 380, 35, "MonReseauWiFi");
-    
-    lv_obj_t* card_password = createCard(content_area, 20, 250, 420, 80);
-    const char* password_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Mot de passe" : "Password") : 
-        "Mot de passe";
-    label_password = createLabel(card_password, 20, 10, password_text, 
-                                LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
-    textarea_password = createTextArea(card_password, 20, 35, 380, 35, "");
-    lv_textarea_set_password_mode(textarea_password, true);
-    
-    const char* connect_text = globalTranslator ? 
-        (globalTranslator->getCurrentLanguage() == Text::Language::FRENCH ? "Se connecter" : "Connect") : 
-        "Se connecter";
-    btn_connect = createButton(content_area, 150, 350, 180, 50, connect_text, 
-                              LVGLStyles::COLOR_SUCCESS);
-    lv_obj_add_event_cb(btn_connect, on_connect, LV_EVENT_CLICKED, this);
+    switch (part) {
+        case 0: {
+            const char* title_text = Text::get(globalTranslator, StrId::SETTINGS_WIFI);
+            auto* title = createLabel(content_area, 0, 10, title_text, 
+                                     LVGLStyles::FONT_MEDIUM, LVGLStyles::COLOR_TEXT_PRIMARY);
+            TextBindings::bind(this, title, StrId::SETTINGS_WIFI);
+            lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 0);
+
+            lv_obj_t* card_enable = createCard(content_area, 20, 60, 420, 70);
+            const char* enable_text = Text::get(globalTranslator, StrId::NETWORK_WIFI_ENABLE);
+            label_enable = createLabel(card_enable, 20, 20, enable_text, 
+                                      LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
+            TextBindings::bind(this, label_enable, StrId::NETWORK_WIFI_ENABLE);
+            switch_enable = createSwitch(card_enable, 350, 20, wifiEnabled);
+            setWidgetId(switch_enable, W_ENABLE);
+            break;
+        }
+        case 1: {
+            lv_obj_t* card_ssid = createCard(content_area, 20, 150, 420, 80);
+            const char* ssid_text = Text::get(globalTranslator, StrId::NETWORK_WIFI_SSID);
+            label_ssid = createLabel(card_ssid, 20, 10, ssid_text, 
+                                    LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
+            TextBindings::bind(this, label_ssid, StrId::NETWORK_WIFI_SSID);
+            textarea_ssid = createTextArea(card_ssid, 20, 35, 380, 35, "MonReseauWiFi");
+            break;
+        }
+        case 2: {
+            lv_obj_t* card_password = createCard(content_area, 20, 250, 420, 80);
+            const char* password_text = Text::get(globalTranslator, StrId::NETWORK_WIFI_PASSWORD);
+            label_password = createLabel(card_password, 20, 10, password_text, 
+                                        LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
+            TextBindings::bind(this, label_password, StrId::NETWORK_WIFI_PASSWORD);
+            textarea_password = createTextArea(card_password, 20, 35, 380, 35, "", InputMode::PASSWORD);
+            break;
+        }
+        case 3: {
+            const char* connect_text = Text::get(globalTranslator, StrId::NETWORK_WIFI_CONNECT);
+            btn_connect = createButton(content_area, 150, 350, 180, 50, connect_text, 
+                                      LVGLStyles::COLOR_SUCCESS);
+            TextBindings::bind(this, lv_obj_get_child(btn_connect, 0), StrId::NETWORK_WIFI_CONNECT);
+            setWidgetId(btn_connect, W_CONNECT);
+            break;
+        }
+        case 4: {
+            lv_obj_t* card_networks = createCard(content_area, 20, 420, 420, 270);
+            const char* networks_text = Text::get(globalTranslator, StrId::NETWORK_WIFI_NETWORKS);
+            auto* label_networks = createLabel(card_networks, 20, 10, networks_text,
+                                               LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
+            TextBindings::bind(this, label_networks, StrId::NETWORK_WIFI_NETWORKS);
+            // Rows are pooled, a crowded scan costs the same objects as an empty one
+            networkList.create(card_networks, 10, 40, 400, 215, 40,
+                               network_text, on_network_selected, this);
+            networkList.setCount(networkCount);
+            break;
+        }
+    }
 }
 
-void WiFiPageLVGL::on_switch_changed(lv_event_t* e) {
-    WiFiPageLVGL* page = (WiFiPageLVGL*)e->user_data;
-    if (!page) return;
-    page->wifiEnabled = lv_obj_has_state(page->switch_enable, LV_STATE_CHECKED);
-    Serial.printf("[WiFiPageLVGL] WiFi %s\n", page->wifiEnabled ? "enabled" : "disabled");
+bool WiFiPageLVGL::onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) {
+    return dispatchWidgetEvent(this, routes, id, code, target);
 }
 
-void WiFiPageLVGL::on_connect(lv_event_t* e) {
-    WiFiPageLVGL* page = (WiFiPageLVGL*)e->user_data;
-    if (!page) return;
+void WiFiPageLVGL::on_switch_changed(lv_obj_t* target) {
+    wifiEnabled = lv_obj_has_state(switch_enable, LV_STATE_CHECKED);
+    Serial.printf("[WiFiPageLVGL] WiFi %s\n", wifiEnabled ? "enabled" : "disabled");
+    if (wifiEnabled) {
+        startScan();
+    } else {
+        stopScan();
+        networkCount = 0;
+        networkList.setCount(0);
+    }
+}
+
+void WiFiPageLVGL::on_connect(lv_obj_t* target) {
     Serial.println("[WiFiPageLVGL] Connexion WiFi demandée");
     // TODO: Implémenter la connexion WiFi
 }
 
+void WiFiPageLVGL::onEnter() {
+    if (wifiEnabled) startScan();
+}
+
+void WiFiPageLVGL::onExit() {
+    stopScan();
+}
+
+/**
+ * @brief Starts an asynchronous scan, results are picked up by on_scan_poll().
+ */
+void WiFiPageLVGL::startScan() {
+    if (scanTimer) return;
+    WiFi.mode(WIFI_STA);
+    if (WiFi.scanNetworks(true) == WIFI_SCAN_FAILED) {
+        Serial.println("[WiFiPageLVGL] Scan failed to start");
+        return;
+    }
+    scanTimer = lv_timer_create(on_scan_poll, SCAN_POLL_MS, this);
+}
+
+void WiFiPageLVGL::stopScan() {
+    if (scanTimer) {
+        lv_timer_del(scanTimer);
+        scanTimer = nullptr;
+    }
+    WiFi.scanDelete();
+}
+
+/**
+ * @brief Copies the scan results once the driver is done, then frees them.
+ * @param timer LVGL timer (user_data is the page).
+ */
+void WiFiPageLVGL::on_scan_poll(lv_timer_t* timer) {
+    WiFiPageLVGL* page = (WiFiPageLVGL*)timer->user_data;
+    int16_t found = WiFi.scanComplete();
+    if (found == WIFI_SCAN_RUNNING) return;
+
+    page->networkCount = 0;
+    for (int16_t i = 0; i < found && page->networkCount < MAX_NETWORKS; i++) {
+        Network& net = page->networks[page->networkCount++];
+        strncpy(net.ssid, WiFi.SSID(i).c_str(), sizeof(net.ssid) - 1);
+        net.ssid[sizeof(net.ssid) - 1] = '\0';
+        net.rssi = (int8_t)WiFi.RSSI(i);
+    }
+    Serial.printf("[WiFiPageLVGL] Scan done: %d networks\n", found < 0 ? 0 : found);
+    page->stopScan();
+    page->networkList.setCount(page->networkCount);
+}
+
+const char* WiFiPageLVGL::network_text(void* ctx, uint32_t index, char* buf, size_t len) {
+    WiFiPageLVGL* page = (WiFiPageLVGL*)ctx;
+    if (index >= page->networkCount) return "";
+    const Network& net = page->networks[index];
+    snprintf(buf, len, "%s  (%d dBm)", net.ssid, net.rssi);
+    return buf;
+}
+
+void WiFiPageLVGL::on_network_selected(void* ctx, uint32_t index) {
+    WiFiPageLVGL* page = (WiFiPageLVGL*)ctx;
+    if (index >= page->networkCount || !page->textarea_ssid) return;
+    lv_textarea_set_text(page->textarea_ssid, page->networks[index].ssid);
+}
+
+void WiFiPageLVGL::saveState() {
+    LVGLPageBase::saveState();
+    saveTextArea(textarea_ssid, saved_ssid, sizeof(saved_ssid));
+    saveTextArea(textarea_password, saved_password, sizeof(saved_password));
+}
+
+void WiFiPageLVGL::restoreState() {
+    if (hasSavedState) {
+        restoreTextArea(textarea_ssid, saved_ssid);
+        restoreTextArea(textarea_password, saved_password);
+    }
+    LVGLPageBase::restoreState();
+}
@@ -13,13 +13,22 @@
 #define WIFI_PAGE_LVGL_HPP
 
 #include "utils/LVGLPageBase.hpp"
+#include "utils/VirtualList.hpp"
 #include "../Translation/text.hpp"
 
 class PageManager;
 
-class WiFiPageLVGL : public LVGLPageBase, public Page {
+class WiFiPageLVGL : public LVGLPageBase {
 private:
     static Text* globalTranslator;
+    // Scan results copied for the list, the driver buffer is freed right after
+    static constexpr uint8_t MAX_NETWORKS = 32;
+    static constexpr uint32_t SCAN_POLL_MS = 250;
+
+    struct Network {
+        char ssid[33];
+        int8_t rssi;
+    };
     
     lv_obj_t* switch_enable;
     lv_obj_t* label_enable;
@@ -28,18 +37,45 @@ private:
     lv_obj_t* textarea_password;
     lv_obj_t* label_password;
     lv_obj_t* btn_connect;
+    VirtualList networkList;
+    lv_timer_t* scanTimer;
     
     bool wifiEnabled;
+    Network networks[MAX_NETWORKS];
+    uint8_t networkCount;
+    
+    char saved_ssid[33];
+    char saved_password[65];
+    
+    enum WidgetId : uint8_t {
+        W_ENABLE = 0,
+        W_CONNECT
+    };
+    static const WidgetRoute<WiFiPageLVGL> routes[];
+    
+    void on_switch_changed(lv_obj_t* target);
+    void on_connect(lv_obj_t* target);
+    void startScan();
+    void stopScan();
+
+    static void on_scan_poll(lv_timer_t* timer);
+    static const char* network_text(void* ctx, uint32_t index, char* buf, size_t len);
+    static void on_network_selected(void* ctx, uint32_t index);
     
-    static void on_switch_changed(lv_event_t* e);
-    static void on_connect(lv_event_t* e);
+protected:
+    bool onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) override;
+    int buildPartCount() const override { return 5; }
+    void buildPart(int part) override;
     
 public:
     WiFiPageLVGL(PageManager* mgr = nullptr);
-    void build(PageType type = STANDARD) override;
     void show() override { LVGLPageBase::show(); }
+    void saveState() override;
+    void restoreState() override;
+    void onEnter() override;
+    void onExit() override;
     void create() override {
-        if (!screen) {
+        if (!isCreated()) {
             build(STANDARD);
         }
     }
@@ -0,0 +1,184 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   DeviceState.cpp                                :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/20 13:05:41 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/20 13:05:41 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file DeviceState.cpp
+ * @brief Seqlock publication of the device state snapshot.
+ */
+
+#include "DeviceState.hpp"
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <cstring>
+
+static_assert(sizeof(DeviceSnapshot) % sizeof(uint32_t) == 0, "snapshot is copied word by word");
+static_assert(sizeof(uint32_t) * (DeviceState::WORDS + 1) <= DEVICE_STATE_LINE,
+              "sequence and snapshot must share one cache line");
+
+DeviceState::Cell DeviceState::cell = {};
+std::atomic<uint32_t> DeviceState::reads(0);
+std::atomic<uint32_t> DeviceState::retries(0);
+std::atomic<uint32_t> DeviceState::maxRetries(0);
+uint32_t DeviceState::writes[static_cast<uint8_t>(DeviceWriter::COUNT)] = {};
+uint32_t DeviceState::unchanged = 0;
+
+namespace {
+
+// Serializes writers; readers never take it
+portMUX_TYPE writerLock = portMUX_INITIALIZER_UNLOCKED;
+
+const char* const WRITER_NAMES[] = { "none", "ui", "sensors", "control", "network" };
+static_assert(sizeof(WRITER_NAMES) / sizeof(WRITER_NAMES[0]) == static_cast<uint8_t>(DeviceWriter::COUNT),
+              "one name per writer");
+
+}
+
+/**
+ * @brief Copies the words between two even, equal sequence values. The
+ * words are atomics loaded relaxed, so a torn copy is never a data race;
+ * it is detected by the second sequence load and retried.
+ */
+DeviceSnapshot DeviceState::read(uint32_t* sequence) {
+    uint32_t words[WORDS];
+    uint32_t begin;
+    uint32_t tries = 0;
+
+    for (;;) {
+        begin = cell.sequence.load(std::memory_order_acquire);
+        if (!(begin & 1)) {
+            for (uint8_t i = 0; i < WORDS; i++) words[i] = cell.words[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (cell.sequence.load(std::memory_order_relaxed) == begin) break;
+        }
+        tries++;
+    }
+
+    reads.fetch_add(1, std::memory_order_relaxed);
+    if (tries) {
+        retries.fetch_add(tries, std::memory_order_relaxed);
+        uint32_t peak = maxRetries.load(std::memory_order_relaxed);
+        while (tries > peak && !maxRetries.compare_exchange_weak(peak, tries, std::memory_order_relaxed)) {}
+    }
+
+    DeviceSnapshot out;
+    memcpy(&out, words, sizeof(out));
+    if (sequence) *sequence = begin;
+    return out;
+}
+
+bool DeviceState::readIfChanged(DeviceSnapshot& out, uint32_t& seen) {
+    if (sequence() == seen) return false;
+    out = read(&seen);
+    return true;
+}
+
+/**
+ * @brief Enters the writer section and returns the current state (the
+ * writer owns the words, so no retry is needed).
+ */
+DeviceSnapshot DeviceState::beginWrite() {
+    portENTER_CRITICAL(&writerLock);
+    uint32_t words[WORDS];
+    for (uint8_t i = 0; i < WORDS; i++) words[i] = cell.words[i].load(std::memory_order_relaxed);
+    DeviceSnapshot current;
+    memcpy(&current, words, sizeof(current));
+    return current;
+}
+
+/**
+ * @brief Publishes after (odd sequence, words, even sequence) and leaves
+ * the writer section. Nothing is published when the values are unchanged.
+ */
+void DeviceState::commit(const DeviceSnapshot& before, DeviceSnapshot& after, DeviceWriter writer) {
+    after.updatedMs = before.updatedMs;
+    after.writer = before.writer;
+    if (memcmp(&before, &after, sizeof(after)) == 0) {
+        unchanged++;
+        portEXIT_CRITICAL(&writerLock);
+        return;
+    }
+    after.updatedMs = millis();
+    after.writer = writer;
+
+    uint32_t words[WORDS];
+    memcpy(words, &after, sizeof(words));
+    uint32_t seq = cell.sequence.load(std::memory_order_relaxed);
+    cell.sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (uint8_t i = 0; i < WORDS; i++) cell.words[i].store(words[i], std::memory_order_relaxed);
+    cell.sequence.store(seq + 2, std::memory_order_release);
+
+    writes[static_cast<uint8_t>(writer)]++;
+    portEXIT_CRITICAL(&writerLock);
+}
+
+void DeviceState::setMeasurements(float ph, float redox, float temperature, DeviceWriter writer) {
+    DeviceSnapshot before = beginWrite();
+    DeviceSnapshot after = before;
+    after.ph = ph;
+    after.redox = redox;
+    after.temperature = temperature;
+    commit(before, after, writer);
+}
+
+void DeviceState::setPower(bool on, DeviceWriter writer) {
+    DeviceSnapshot before = beginWrite();
+    DeviceSnapshot after = before;
+    after.powerOn = on;
+    commit(before, after, writer);
+}
+
+void DeviceState::setPump(bool on, DeviceWriter writer) {
+    DeviceSnapshot before = beginWrite();
+    DeviceSnapshot after = before;
+    after.pumpOn = on;
+    commit(before, after, writer);
+}
+
+void DeviceState::setPumpSpeed(uint8_t percent, DeviceWriter writer) {
+    DeviceSnapshot before = beginWrite();
+    DeviceSnapshot after = before;
+    after.pumpSpeed = percent > 100 ? 100 : percent;
+    commit(before, after, writer);
+}
+
+bool DeviceState::togglePower(DeviceWriter writer) {
+    DeviceSnapshot before = beginWrite();
+    DeviceSnapshot after = before;
+    after.powerOn = !before.powerOn;
+    commit(before, after, writer);
+    return after.powerOn;
+}
+
+bool DeviceState::togglePump(DeviceWriter writer) {
+    DeviceSnapshot before = beginWrite();
+    DeviceSnapshot after = before;
+    after.pumpOn = !before.pumpOn;
+    commit(before, after, writer);
+    return after.pumpOn;
+}
+
+void DeviceState::printReport(Print& out) {
+    uint32_t seq;
+    DeviceSnapshot s = read(&seq);
+    out.printf("=== Device state ===\n");
+    out.printf("seq %lu  pH %.2f  redox %.0f mV  temp %.1f C  power %s  pump %s %u%%\n",
+               (unsigned long)seq, s.ph, s.redox, s.temperature,
+               s.powerOn ? "on" : "off", s.pumpOn ? "on" : "off", (unsigned)s.pumpSpeed);
+    out.printf("last write by %s %lu ms ago\n", WRITER_NAMES[static_cast<uint8_t>(s.writer)],
+               (unsigned long)(millis() - s.updatedMs));
+    out.printf("reads %lu  retries %lu  max retries %lu  unchanged writes %lu\n",
+               (unsigned long)reads.load(), (unsigned long)retries.load(),
+               (unsigned long)maxRetries.load(), (unsigned long)unchanged);
+    for (uint8_t i = 1; i < static_cast<uint8_t>(DeviceWriter::COUNT); i++) {
+        out.printf("  %-8s writes %lu\n", WRITER_NAMES[i], (unsigned long)writes[i]);
+    }
+}
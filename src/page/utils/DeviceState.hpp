@@ -0,0 +1,124 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   DeviceState.hpp                                :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/20 13:05:41 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/20 13:05:41 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file DeviceState.hpp
+ * @brief Device state snapshot shared by the UI, network and control tasks.
+ *
+ * Source unique de l'état de l'équipement (mesures, alimentation, pompe).
+ * L'état publié tient dans une ligne de cache, protégé par un seqlock :
+ * le compteur de séquence est impair pendant une écriture, un lecteur copie
+ * les mots puis recommence si la séquence a bougé. Les lecteurs ne prennent
+ * aucun verrou et ne bloquent jamais les écrivains ; les écrivains (peu
+ * nombreux, écritures de quelques mots) sont sérialisés entre eux par une
+ * section critique.
+ *
+ * La tâche UI recopie les changements dans UiStore une fois par cycle ;
+ * les pages écrivent ici plutôt que de garder leur propre copie de l'état.
+ */
+
+#ifndef DEVICE_STATE_HPP
+#define DEVICE_STATE_HPP
+
+#include <atomic>
+#include <stdint.h>
+
+class Print;
+
+/** @brief Ligne de cache des données de l'ESP32-S3 */
+#ifndef DEVICE_STATE_LINE
+#define DEVICE_STATE_LINE 32
+#endif
+
+/**
+ * @brief Auteur d'une écriture (permet à un écrivain d'ignorer ses propres échos)
+ */
+enum class DeviceWriter : uint8_t {
+    NONE,
+    UI,
+    SENSORS,
+    CONTROL,
+    NETWORK,
+    COUNT
+};
+
+/**
+ * @brief Copie cohérente de l'état (20 octets, copiée par valeur)
+ */
+struct DeviceSnapshot {
+    float ph;
+    float redox;            // mV
+    float temperature;      // °C
+    uint32_t updatedMs;     // millis() de la dernière modification
+    uint8_t powerOn;
+    uint8_t pumpOn;
+    uint8_t pumpSpeed;      // %
+    DeviceWriter writer;    // auteur de la dernière modification
+};
+
+class DeviceState {
+public:
+    static constexpr uint8_t WORDS = sizeof(DeviceSnapshot) / sizeof(uint32_t);
+
+    /**
+     * @brief Lecture cohérente, sans verrou (toute tâche)
+     * @param sequence Reçoit la séquence de la copie lue (optionnel)
+     */
+    static DeviceSnapshot read(uint32_t* sequence = nullptr);
+
+    /**
+     * @brief Lit l'état seulement s'il a changé depuis la séquence seen
+     * @return false si rien n'a changé (out et seen inchangés)
+     */
+    static bool readIfChanged(DeviceSnapshot& out, uint32_t& seen);
+
+    /**
+     * @brief Séquence courante (paire hors écriture, +2 par modification)
+     */
+    static uint32_t sequence() { return cell.sequence.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Écritures ; une valeur identique ne publie rien
+     */
+    static void setMeasurements(float ph, float redox, float temperature, DeviceWriter writer);
+    static void setPower(bool on, DeviceWriter writer);
+    static void setPump(bool on, DeviceWriter writer);
+    static void setPumpSpeed(uint8_t percent, DeviceWriter writer);
+
+    /**
+     * @brief Inverse l'état sous le verrou d'écriture (pas de lecture puis écriture)
+     * @return Le nouvel état
+     */
+    static bool togglePower(DeviceWriter writer);
+    static bool togglePump(DeviceWriter writer);
+
+    static void printReport(Print& out);
+
+private:
+    // Séquence et données dans la même ligne de cache
+    struct alignas(DEVICE_STATE_LINE) Cell {
+        std::atomic<uint32_t> sequence;
+        std::atomic<uint32_t> words[WORDS];
+    };
+
+    static Cell cell;
+
+    static std::atomic<uint32_t> reads;
+    static std::atomic<uint32_t> retries;
+    static std::atomic<uint32_t> maxRetries;
+    static uint32_t writes[static_cast<uint8_t>(DeviceWriter::COUNT)];
+    static uint32_t unchanged;
+
+    static DeviceSnapshot beginWrite();
+    static void commit(const DeviceSnapshot& before, DeviceSnapshot& after, DeviceWriter writer);
+};
+
+#endif
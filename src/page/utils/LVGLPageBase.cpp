@@ -16,48 +16,83 @@
 
 #include "LVGLPageBase.hpp"
 #include "PageManager.hpp"
+#include "SharedKeyboard.hpp"
+#include "UiStore.hpp"
+#include "TextBindings.hpp"
 #include <iostream>
 
-LVGLPageBase::LVGLPageBase(const char* titleText, PageManager* mgr)
+LVGLPageBase::LVGLPageBase(StrId title, PageManager* mgr, PageType type)
     : screen(nullptr), navbar(nullptr), content_area(nullptr), backButton(nullptr),
-      nextPageId(-1), title(titleText), pageManager(mgr) {}
+      nextPageId(-1), titleId(title), pageManager(mgr),
+      savedScrollY(0), hasSavedState(false), pageType(type), builtParts(0),
+      layoutBinding(nullptr) {}
 
 LVGLPageBase::~LVGLPageBase() {
     if (screen) lv_obj_del(screen);
 }
 
+/**
+ * @brief Builds the screen, then every part not built yet (pages split
+ * into parts don't need to override this).
+ */
 void LVGLPageBase::build(PageType type) {
-    if (screen) return;
+    if (!screen) buildFrame(type);
+    while (builtParts < buildPartCount()) {
+        buildPart(builtParts++);
+    }
+}
+
+/**
+ * @brief Builds one more piece of the page: the screen and its navbar
+ * first, then one part per call.
+ * @return true once the page is complete.
+ */
+bool LVGLPageBase::buildStep() {
+    if (buildPartCount() == 0) {
+        create();
+        return true;
+    }
+    if (!screen) buildFrame(pageType);
+    else if (builtParts < buildPartCount()) buildPart(builtParts++);
+    return isCreated();
+}
+
+void LVGLPageBase::buildFrame(PageType type) {
     screen = lv_obj_create(nullptr);
+    builtParts = 0;
+    lv_obj_add_event_cb(screen, on_widget_event, LV_EVENT_ALL, this);
 
     switch(type) {
         case HOME: {
-            lv_obj_set_style_bg_color(screen, lv_color_hex(LVGLStyles::COLOR_BACKGROUND), 0);
+            applyBgColor(screen, LVGLStyles::COLOR_BACKGROUND);
             break;
         }
         case STANDARD: {
-            lv_obj_set_style_bg_color(screen, lv_color_hex(LVGLStyles::COLOR_BACKGROUND), 0);
-            navbar = createNavBar(screen, title ? title : "");
+            applyBgColor(screen, LVGLStyles::COLOR_BACKGROUND);
+            navbar = createNavBar(screen, "");
+            TextBindings::bind(this, lv_obj_get_child(navbar, 0), titleId);
             backButton = createButton(navbar, 0, 0, 50, 50, "X", LVGLStyles::COLOR_DANGER, 0);
             lv_obj_align(backButton, LV_ALIGN_TOP_LEFT, -10, -10);
             lv_obj_add_flag(backButton, LV_OBJ_FLAG_CLICKABLE);
-            lv_obj_add_event_cb(backButton, on_back_clicked, LV_EVENT_CLICKED, this);
+            setWidgetId(backButton, WIDGET_BACK);
             content_area = createScrollableList(screen, 10, 60, 460, 200);
             break;
         }
         case ALERT: {
-            lv_obj_set_style_bg_color(screen, lv_color_hex(LVGLStyles::COLOR_DANGER), 0);
-            navbar = createNavBar(screen, title ? title : "");
+            applyBgColor(screen, LVGLStyles::COLOR_DANGER);
+            navbar = createNavBar(screen, "");
+            TextBindings::bind(this, lv_obj_get_child(navbar, 0), titleId);
             lv_obj_add_flag(navbar, LV_OBJ_FLAG_CLICKABLE);
-            lv_obj_add_event_cb(navbar, on_back_clicked, LV_EVENT_CLICKED, this);
+            setWidgetId(navbar, WIDGET_BACK);
             content_area = createScrollableList(screen, 10, 60, 460, 200);
             break;
         }
         case INFO: {
-            lv_obj_set_style_bg_color(screen, lv_color_hex(LVGLStyles::COLOR_INFO), 0);
-            navbar = createNavBar(screen, title ? title : "");
+            applyBgColor(screen, LVGLStyles::COLOR_INFO);
+            navbar = createNavBar(screen, "");
+            TextBindings::bind(this, lv_obj_get_child(navbar, 0), titleId);
             lv_obj_add_flag(navbar, LV_OBJ_FLAG_CLICKABLE);
-            lv_obj_add_event_cb(navbar, on_back_clicked, LV_EVENT_CLICKED, this);
+            setWidgetId(navbar, WIDGET_BACK);
             content_area = createScrollableList(screen, 10, 60, 460, 200);
             break;
         }
@@ -65,9 +100,9 @@ void LVGLPageBase::build(PageType type) {
 }
 
 void LVGLPageBase::show() {
-    if (!screen) {
+    if (!isCreated()) {
         Serial.println("[LVGLPageBase] screen is NULL, calling build()");
-        build();
+        build(pageType);
     }
     if (!screen) {
         Serial.println("[LVGLPageBase] ERROR: screen is still NULL after build()!");
@@ -76,9 +111,75 @@ void LVGLPageBase::show() {
     fade_to_screen(screen, LVGL_FADE_MS);
 }
 
-void LVGLPageBase::on_back_clicked(lv_event_t* e) {
-    auto* self = static_cast<LVGLPageBase*>(e->user_data);
-    if (!self || !self->pageManager) return;
-    
-    self->pageManager->navigateToPage(PageID::PAGE_SETTINGS);
+void LVGLPageBase::destroy() {
+    if (!screen) return;
+    if (isCreated()) saveState();
+    UiStore::unbind(this);
+    TextBindings::unbind(this);
+    clearLayoutWidgets(layoutBinding);
+    lv_obj_del(screen);
+    screen = nullptr;
+    builtParts = 0;
+    navbar = nullptr;
+    content_area = nullptr;
+    backButton = nullptr;
+}
+
+/**
+ * @brief Keeps the scroll position of the content area. Pages holding
+ * widget state outside their members (text areas...) extend this.
+ */
+void LVGLPageBase::saveState() {
+    savedScrollY = content_area ? lv_obj_get_scroll_y(content_area) : 0;
+    hasSavedState = true;
+}
+
+void LVGLPageBase::restoreState() {
+    if (!hasSavedState) return;
+    if (content_area && savedScrollY) {
+        lv_obj_update_layout(content_area);
+        lv_obj_scroll_to_y(content_area, savedScrollY, LV_ANIM_OFF);
+    }
+    hasSavedState = false;
+}
+
+void LVGLPageBase::saveTextArea(lv_obj_t* textarea, char* buf, size_t size) {
+    if (!textarea || !size) return;
+    snprintf(buf, size, "%s", lv_textarea_get_text(textarea));
+}
+
+void LVGLPageBase::restoreTextArea(lv_obj_t* textarea, const char* buf) {
+    if (textarea) lv_textarea_set_text(textarea, buf);
+}
+
+/**
+ * @brief Back button / navbar action, returns to the settings page by default.
+ */
+void LVGLPageBase::onBack() {
+    if (pageManager) pageManager->navigateToPage(PageID::PAGE_SETTINGS);
+}
+
+/**
+ * @brief Single screen callback: widget events bubble up here and are
+ * dispatched by widget ID to the layout, then to the page, then to the
+ * default back action.
+ */
+void LVGLPageBase::on_widget_event(lv_event_t* e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    if (code != LV_EVENT_CLICKED && code != LV_EVENT_VALUE_CHANGED) return;
+
+    auto* self = static_cast<LVGLPageBase*>(lv_event_get_user_data(e));
+    lv_obj_t* target = lv_event_get_target(e);
+    int id = widgetId(target);
+    if (!self || id < 0) return;
+
+    if (id >= WIDGET_INPUT_BASE && id < WIDGET_INPUT_BASE + static_cast<int>(InputMode::COUNT)) {
+        if (code == LV_EVENT_CLICKED) {
+            SharedKeyboard::open(target, static_cast<InputMode>(id - WIDGET_INPUT_BASE));
+        }
+        return;
+    }
+    if (self->layoutBinding && handleLayoutEvent(self->layoutBinding, (uint8_t)id, code, target)) return;
+    if (self->onWidgetEvent((uint8_t)id, code, target)) return;
+    if (id == WIDGET_BACK && code == LV_EVENT_CLICKED) self->onBack();
 }
@@ -25,24 +25,53 @@
 
 class PageManager;
 
-class LVGLPageBase {
+class LVGLPageBase : public Page {
 protected:
     lv_obj_t* screen;
     lv_obj_t* navbar;
     lv_obj_t* content_area;
     lv_obj_t* backButton;
     int nextPageId;
-    const char* title;
+    StrId titleId;
     PageManager* pageManager;
 
-    static void on_back_clicked(lv_event_t* e);
+    lv_coord_t savedScrollY;
+    bool hasSavedState;
+
+    // Frame built by buildStep() and show(), fixed by the constructor
+    PageType pageType;
+
+    // Resumable build: pages split into parts override these two
+    int builtParts;
+    virtual int buildPartCount() const { return 0; }
+    virtual void buildPart(int part) {}
+
+    void buildFrame(PageType type);
+
+    // Event delegation: one callback on the screen, widgets tagged with setWidgetId()
+    static constexpr uint8_t WIDGET_BACK = 0xFF;
+    const LayoutBinding* layoutBinding;
+    virtual bool onWidgetEvent(uint8_t id, lv_event_code_t code, lv_obj_t* target) { return false; }
+    virtual void onBack();
+
+    static void on_widget_event(lv_event_t* e);
+
+    static void saveTextArea(lv_obj_t* textarea, char* buf, size_t size);
+    static void restoreTextArea(lv_obj_t* textarea, const char* buf);
 
 public:
-    explicit LVGLPageBase(const char* titleText, PageManager* mgr = nullptr);
+    explicit LVGLPageBase(StrId title, PageManager* mgr = nullptr, PageType type = STANDARD);
     virtual ~LVGLPageBase();
 
     virtual void build(PageType type = STANDARD);
     virtual void show();
+
+    void destroy() override;
+    bool buildStep() override;
+    bool isCreated() const override { return screen && builtParts >= buildPartCount(); }
+    bool isBuilding() const override { return screen && builtParts < buildPartCount(); }
+    void saveState() override;
+    void restoreState() override;
     
     void setPageManager(PageManager* mgr) { pageManager = mgr; }
 
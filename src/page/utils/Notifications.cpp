@@ -0,0 +1,432 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   Notifications.cpp                              :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 21:31:47 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 21:31:47 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file Notifications.cpp
+ * @brief Pre-built dialog/toast objects reused with new text, with queues and rate limiting.
+ */
+
+#include "Notifications.hpp"
+#include "interface-utils-lvgl.hpp"
+#include <Arduino.h>
+
+Text* Notifications::translator = nullptr;
+
+lv_obj_t* Notifications::confirmOverlay = nullptr;
+lv_obj_t* Notifications::confirmQuestion = nullptr;
+lv_obj_t* Notifications::confirmSubject = nullptr;
+lv_obj_t* Notifications::confirmYes = nullptr;
+lv_obj_t* Notifications::confirmNo = nullptr;
+lv_obj_t* Notifications::alertOverlay = nullptr;
+lv_obj_t* Notifications::alertTitle = nullptr;
+lv_obj_t* Notifications::alertText = nullptr;
+lv_obj_t* Notifications::alertOk = nullptr;
+lv_obj_t* Notifications::toastBox = nullptr;
+lv_obj_t* Notifications::toastLabel = nullptr;
+lv_timer_t* Notifications::toastTimer = nullptr;
+
+Notifications::Kind Notifications::dialogOpen = Notifications::NONE;
+Notifications::Dialog Notifications::currentDialog = {};
+Notifications::Dialog Notifications::dialogQueue[DIALOG_QUEUE] = {};
+uint8_t Notifications::dialogHead = 0;
+uint8_t Notifications::dialogCount = 0;
+
+Notifications::ToastState Notifications::toastState = Notifications::IDLE;
+Notifications::Toast Notifications::currentToast = {};
+char Notifications::toastText[TEXT_LEN + 8] = {};
+uint32_t Notifications::toastPhaseStart = 0;
+Notifications::Toast Notifications::toastQueue[TOAST_QUEUE] = {};
+uint8_t Notifications::toastHead = 0;
+uint8_t Notifications::toastCount = 0;
+
+uint32_t Notifications::postedToasts = 0;
+uint32_t Notifications::shownToasts = 0;
+uint32_t Notifications::mergedToasts = 0;
+uint32_t Notifications::droppedToasts = 0;
+uint32_t Notifications::postedDialogs = 0;
+uint32_t Notifications::droppedDialogs = 0;
+
+static constexpr uint32_t COLOR_HEADER = 0x424242;
+
+/**
+ * @brief Builds the dialog and toast pool on the top layer.
+ * @param translator Translator for the button texts.
+ */
+void Notifications::begin(Text* translator) {
+    Notifications::translator = translator;
+    if (toastBox) return;
+
+    uint32_t start = micros();
+    buildConfirm();
+    buildAlert();
+    buildToast();
+    toastTimer = lv_timer_create(on_toast_tick, TICK_MS, nullptr);
+    lv_timer_pause(toastTimer);
+    Serial.printf("[Notifications] Pool built in %lu us\n", (unsigned long)(micros() - start));
+}
+
+/**
+ * @brief Confirmation dialog: question, large subject, YES / NO (Confirmations mockup).
+ */
+void Notifications::buildConfirm() {
+    confirmOverlay = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(confirmOverlay, lv_pct(100), lv_pct(100));
+    applyBgColor(confirmOverlay, LVGLStyles::COLOR_DANGER);
+    lv_obj_set_style_border_width(confirmOverlay, 0, 0);
+    lv_obj_set_style_radius(confirmOverlay, 0, 0);
+    lv_obj_clear_flag(confirmOverlay, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(confirmOverlay, on_dialog_event, LV_EVENT_CLICKED, nullptr);
+
+    lv_obj_t* box = lv_obj_create(confirmOverlay);
+    lv_obj_set_size(box, 420, 200);
+    lv_obj_center(box);
+    lv_obj_add_style(box, LVGLStyles::shared(LVGLStyles::MODAL), 0);
+    lv_obj_clear_flag(box, LV_OBJ_FLAG_SCROLLABLE);
+
+    confirmQuestion = lv_label_create(box);
+    lv_label_set_long_mode(confirmQuestion, LV_LABEL_LONG_WRAP);
+    lv_obj_set_width(confirmQuestion, 380);
+    lv_obj_set_style_text_align(confirmQuestion, LV_TEXT_ALIGN_CENTER, 0);
+    applyTextStyle(confirmQuestion, LVGLStyles::FONT_MEDIUM, LVGLStyles::COLOR_TEXT_PRIMARY);
+    lv_obj_align(confirmQuestion, LV_ALIGN_TOP_MID, 0, 0);
+
+    confirmSubject = lv_label_create(box);
+    applyTextStyle(confirmSubject, LVGLStyles::FONT_XLARGE, LVGLStyles::COLOR_BLACK);
+    lv_obj_align(confirmSubject, LV_ALIGN_CENTER, 0, -5);
+
+    confirmYes = createButton(box, 40, 125, 140, 45, "", LVGLStyles::COLOR_SUCCESS);
+    setWidgetId(confirmYes, W_YES);
+    confirmNo = createButton(box, 220, 125, 140, 45, "", LVGLStyles::COLOR_DANGER);
+    setWidgetId(confirmNo, W_NO);
+
+    lv_obj_add_flag(confirmOverlay, LV_OBJ_FLAG_HIDDEN);
+}
+
+/**
+ * @brief Alert dialog: dark header with a red dot and the title, message, OK (Alerte mockup).
+ */
+void Notifications::buildAlert() {
+    alertOverlay = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(alertOverlay, lv_pct(100), lv_pct(100));
+    lv_obj_add_style(alertOverlay, LVGLStyles::shared(LVGLStyles::MODAL_OVERLAY), 0);
+    lv_obj_set_style_radius(alertOverlay, 0, 0);
+    lv_obj_clear_flag(alertOverlay, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(alertOverlay, on_dialog_event, LV_EVENT_CLICKED, nullptr);
+
+    lv_obj_t* card = lv_obj_create(alertOverlay);
+    lv_obj_set_size(card, 400, 220);
+    lv_obj_center(card);
+    lv_obj_add_style(card, LVGLStyles::shared(LVGLStyles::MODAL), 0);
+    lv_obj_set_style_pad_all(card, 0, 0);
+    lv_obj_clear_flag(card, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t* header = lv_obj_create(card);
+    lv_obj_set_size(header, lv_pct(100), 44);
+    lv_obj_set_pos(header, 0, 0);
+    applyBgColor(header, COLOR_HEADER);
+    lv_obj_set_style_border_width(header, 0, 0);
+    lv_obj_set_style_radius(header, 0, 0);
+    lv_obj_clear_flag(header, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_clear_flag(header, LV_OBJ_FLAG_CLICKABLE);
+
+    lv_obj_t* dot = lv_obj_create(header);
+    lv_obj_set_size(dot, 22, 22);
+    lv_obj_add_style(dot, LVGLStyles::shared(LVGLStyles::ICON_BUTTON), 0);
+    applyBgColor(dot, LVGLStyles::COLOR_DANGER);
+    lv_obj_set_style_border_width(dot, 0, 0);
+    lv_obj_align(dot, LV_ALIGN_LEFT_MID, 0, 0);
+    lv_obj_clear_flag(dot, LV_OBJ_FLAG_CLICKABLE);
+
+    alertTitle = lv_label_create(header);
+    applyTextStyle(alertTitle, LVGLStyles::FONT_MEDIUM, LVGLStyles::COLOR_WHITE);
+    lv_obj_align(alertTitle, LV_ALIGN_CENTER, 0, 0);
+
+    alertText = lv_label_create(card);
+    lv_label_set_long_mode(alertText, LV_LABEL_LONG_WRAP);
+    lv_obj_set_width(alertText, 360);
+    applyTextStyle(alertText, LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
+    lv_obj_set_pos(alertText, 20, 60);
+
+    alertOk = createButton(card, 260, 160, 120, 44, "", LVGLStyles::COLOR_PRIMARY);
+    setWidgetId(alertOk, W_OK);
+
+    lv_obj_add_flag(alertOverlay, LV_OBJ_FLAG_HIDDEN);
+}
+
+/**
+ * @brief Toast box at the bottom of the screen, faded by the toast timer.
+ */
+void Notifications::buildToast() {
+    toastBox = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(toastBox, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_add_style(toastBox, LVGLStyles::shared(LVGLStyles::TOAST), 0);
+    lv_obj_clear_flag(toastBox, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_clear_flag(toastBox, LV_OBJ_FLAG_SCROLLABLE);
+
+    toastLabel = lv_label_create(toastBox);
+    lv_obj_add_style(toastLabel, LVGLStyles::shared(LVGLStyles::TOAST_LABEL), 0);
+    lv_label_set_text_static(toastLabel, toastText);
+
+    lv_obj_align(toastBox, LV_ALIGN_BOTTOM_MID, 0, -20);
+    lv_obj_set_style_opa(toastBox, LV_OPA_TRANSP, 0);
+    lv_obj_add_flag(toastBox, LV_OBJ_FLAG_HIDDEN);
+}
+
+/**
+ * @brief Queues a toast. Identical consecutive messages are merged.
+ * @param message Message (copied).
+ * @param duration_ms Display time when no other toast is waiting.
+ * @return False if the queue is full (message dropped).
+ */
+bool Notifications::toast(const char* message, uint32_t duration_ms) {
+    if (!toastBox) {
+        Serial.println("[Notifications] ERROR: begin() not called");
+        return false;
+    }
+    if (!message) message = "";
+    postedToasts++;
+
+    // Same text as the toast on screen: bump its counter and keep it longer
+    if ((toastState == FADE_IN || toastState == VISIBLE) && strcmp(currentToast.text, message) == 0) {
+        currentToast.repeat++;
+        refreshToastText();
+        if (toastState == VISIBLE) toastPhaseStart = lv_tick_get();
+        mergedToasts++;
+        return true;
+    }
+    if (toastCount > 0) {
+        Toast& last = toastQueue[(toastHead + toastCount - 1) % TOAST_QUEUE];
+        if (strcmp(last.text, message) == 0) {
+            last.repeat++;
+            mergedToasts++;
+            return true;
+        }
+    }
+    if (toastCount >= TOAST_QUEUE) {
+        droppedToasts++;
+        return false;
+    }
+
+    Toast& slot = toastQueue[(toastHead + toastCount) % TOAST_QUEUE];
+    snprintf(slot.text, sizeof(slot.text), "%s", message);
+    slot.duration = duration_ms;
+    slot.repeat = 1;
+    toastCount++;
+
+    if (toastState == IDLE) showNextToast();
+    return true;
+}
+
+/**
+ * @brief Takes the next queued toast and starts fading it in.
+ */
+void Notifications::showNextToast() {
+    if (toastCount == 0) return;
+
+    currentToast = toastQueue[toastHead];
+    toastHead = (toastHead + 1) % TOAST_QUEUE;
+    toastCount--;
+    refreshToastText();
+
+    toastState = FADE_IN;
+    toastPhaseStart = lv_tick_get();
+    lv_obj_set_style_opa(toastBox, LV_OPA_TRANSP, 0);
+    lv_obj_clear_flag(toastBox, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_move_foreground(toastBox);
+    lv_timer_resume(toastTimer);
+    shownToasts++;
+}
+
+/**
+ * @brief Writes the toast text (with its repeat count) into the static label buffer.
+ */
+void Notifications::refreshToastText() {
+    if (currentToast.repeat > 1) {
+        snprintf(toastText, sizeof(toastText), "%s (x%u)", currentToast.text, (unsigned)currentToast.repeat);
+    } else {
+        snprintf(toastText, sizeof(toastText), "%s", currentToast.text);
+    }
+    lv_label_set_text_static(toastLabel, toastText);
+    lv_obj_align(toastBox, LV_ALIGN_BOTTOM_MID, 0, -20);
+}
+
+/**
+ * @brief Toast state machine: fade in, stay, fade out, next.
+ * While other toasts wait, each one stays at most TOAST_MIN_MS.
+ * @param timer LVGL timer.
+ */
+void Notifications::on_toast_tick(lv_timer_t* timer) {
+    uint32_t elapsed = lv_tick_elaps(toastPhaseStart);
+
+    switch (toastState) {
+        case FADE_IN:
+            if (elapsed >= FADE_MS) {
+                lv_obj_set_style_opa(toastBox, LV_OPA_COVER, 0);
+                toastState = VISIBLE;
+                toastPhaseStart = lv_tick_get();
+            } else {
+                lv_obj_set_style_opa(toastBox, (lv_opa_t)(elapsed * 255 / FADE_MS), 0);
+            }
+            break;
+
+        case VISIBLE: {
+            uint32_t limit = currentToast.duration;
+            if (toastCount > 0 && limit > TOAST_MIN_MS) limit = TOAST_MIN_MS;
+            if (elapsed >= limit) {
+                toastState = FADE_OUT;
+                toastPhaseStart = lv_tick_get();
+            }
+            break;
+        }
+
+        case FADE_OUT:
+            if (elapsed >= FADE_MS) {
+                lv_obj_add_flag(toastBox, LV_OBJ_FLAG_HIDDEN);
+                toastState = IDLE;
+                if (toastCount > 0) {
+                    showNextToast();
+                } else {
+                    lv_timer_pause(timer);
+                }
+            } else {
+                lv_obj_set_style_opa(toastBox, (lv_opa_t)(255 - elapsed * 255 / FADE_MS), 0);
+            }
+            break;
+
+        case IDLE:
+            lv_timer_pause(timer);
+            break;
+    }
+}
+
+/**
+ * @brief Queues a YES / NO confirmation.
+ * @param question Question shown at the top.
+ * @param subject Subject shown in large letters.
+ * @param cb Result callback.
+ * @param ctx User context for the callback.
+ * @return False if the dialog queue is full.
+ */
+bool Notifications::confirm(const char* question, const char* subject, DialogResult cb, void* ctx) {
+    return queueDialog(CONFIRM, question, subject, cb, ctx);
+}
+
+/**
+ * @brief Queues an alert to acknowledge.
+ * @param title Header title.
+ * @param message Alert text.
+ * @param cb Optional callback, called with true when acknowledged.
+ * @param ctx User context for the callback.
+ * @return False if the dialog queue is full.
+ */
+bool Notifications::alert(const char* title, const char* message, DialogResult cb, void* ctx) {
+    return queueDialog(ALERT, title, message, cb, ctx);
+}
+
+bool Notifications::queueDialog(Kind kind, const char* title, const char* text, DialogResult cb, void* ctx) {
+    if (!confirmOverlay) {
+        Serial.println("[Notifications] ERROR: begin() not called");
+        return false;
+    }
+    postedDialogs++;
+    if (dialogCount >= DIALOG_QUEUE) {
+        droppedDialogs++;
+        Serial.printf("[Notifications] Dialog queue full, dropped \"%s\"\n", title ? title : "");
+        return false;
+    }
+
+    Dialog& slot = dialogQueue[(dialogHead + dialogCount) % DIALOG_QUEUE];
+    slot.kind = kind;
+    snprintf(slot.title, sizeof(slot.title), "%s", title ? title : "");
+    snprintf(slot.text, sizeof(slot.text), "%s", text ? text : "");
+    slot.cb = cb;
+    slot.ctx = ctx;
+    dialogCount++;
+
+    if (dialogOpen == NONE) showNextDialog();
+    return true;
+}
+
+/**
+ * @brief Fills the pooled dialog matching the next queued request and shows it.
+ */
+void Notifications::showNextDialog() {
+    if (dialogCount == 0) return;
+
+    currentDialog = dialogQueue[dialogHead];
+    dialogHead = (dialogHead + 1) % DIALOG_QUEUE;
+    dialogCount--;
+    dialogOpen = currentDialog.kind;
+
+    Text::Language lang = translator ? translator->getCurrentLanguage() : Text::Language::FRENCH;
+    lv_obj_t* overlay;
+    if (dialogOpen == CONFIRM) {
+        lv_label_set_text_static(confirmQuestion, currentDialog.title);
+        lv_label_set_text_static(confirmSubject, currentDialog.text);
+        lv_label_set_text_static(lv_obj_get_child(confirmYes, 0), Text::get(StrId::DIALOG_YES, lang));
+        lv_label_set_text_static(lv_obj_get_child(confirmNo, 0), Text::get(StrId::DIALOG_NO, lang));
+        lv_obj_align(confirmSubject, LV_ALIGN_CENTER, 0, -5);
+        overlay = confirmOverlay;
+    } else {
+        lv_label_set_text_static(alertTitle, currentDialog.title);
+        lv_label_set_text_static(alertText, currentDialog.text);
+        lv_label_set_text_static(lv_obj_get_child(alertOk, 0), Text::get(StrId::DIALOG_OK, lang));
+        lv_obj_align(alertTitle, LV_ALIGN_CENTER, 0, 0);
+        overlay = alertOverlay;
+    }
+    lv_obj_clear_flag(overlay, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_move_foreground(overlay);
+}
+
+/**
+ * @brief Hides the open dialog, reports the answer, then shows the next one.
+ * @param confirmed True for YES / OK.
+ */
+void Notifications::closeDialog(bool confirmed) {
+    if (dialogOpen == NONE) return;
+
+    lv_obj_add_flag(dialogOpen == CONFIRM ? confirmOverlay : alertOverlay, LV_OBJ_FLAG_HIDDEN);
+    DialogResult cb = currentDialog.cb;
+    void* ctx = currentDialog.ctx;
+    dialogOpen = NONE;
+
+    // The callback may queue another dialog, which then opens right away
+    if (cb) cb(ctx, confirmed);
+    if (dialogOpen == NONE) showNextDialog();
+}
+
+/**
+ * @brief Button clicks of both dialogs bubble up to their overlay.
+ * @param e LVGL event.
+ */
+void Notifications::on_dialog_event(lv_event_t* e) {
+    switch (widgetId(lv_event_get_target(e))) {
+        case W_YES:
+        case W_OK:
+            closeDialog(true);
+            break;
+        case W_NO:
+            closeDialog(false);
+            break;
+        default:
+            break;
+    }
+}
+
+void Notifications::printReport(Print& out) {
+    out.printf("=== Notifications ===\n");
+    out.printf("toasts: posted %lu  shown %lu  merged %lu  dropped %lu  queued %u\n",
+               (unsigned long)postedToasts, (unsigned long)shownToasts,
+               (unsigned long)mergedToasts, (unsigned long)droppedToasts, (unsigned)toastCount);
+    out.printf("dialogs: posted %lu  dropped %lu  queued %u  open %s\n",
+               (unsigned long)postedDialogs, (unsigned long)droppedDialogs, (unsigned)dialogCount,
+               dialogOpen == CONFIRM ? "confirm" : dialogOpen == ALERT ? "alert" : "none");
+}
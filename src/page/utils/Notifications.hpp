@@ -0,0 +1,153 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   Notifications.hpp                              :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 21:31:47 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 21:31:47 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file Notifications.hpp
+ * @brief Pooled confirm/alert dialogs and a rate-limited toast queue.
+ */
+
+#ifndef NOTIFICATIONS_HPP
+#define NOTIFICATIONS_HPP
+
+#include <lvgl.h>
+#include "../../Translation/text.hpp"
+
+class Print;
+
+/**
+ * @brief Résultat d'une boîte de dialogue (true = OUI / OK)
+ */
+typedef void (*DialogResult)(void* ctx, bool confirmed);
+
+/**
+ * @class Notifications
+ * @brief Boîtes de dialogue et toasts sans allocation à l'usage.
+ *
+ * Les objets (confirmation, alerte, toast) sont construits une fois sur
+ * lv_layer_top() par begin() puis réutilisés : un message est copié dans
+ * un tampon fixe que les labels référencent (lv_label_set_text_static).
+ * Les demandes sont mises en file ; un seul dialogue et un seul toast sont
+ * visibles à la fois. Les toasts identiques consécutifs sont fusionnés
+ * ("(x3)") et, tant que d'autres attendent, chacun est écourté à
+ * TOAST_MIN_MS au plus pour écouler la file.
+ * Le fondu est fait par un timer LVGL permanent (pas d'lv_anim par toast).
+ */
+class Notifications {
+public:
+    static constexpr uint8_t TITLE_LEN = 48;
+    static constexpr uint8_t TEXT_LEN = 96;
+    static constexpr uint8_t DIALOG_QUEUE = 3;
+    static constexpr uint8_t TOAST_QUEUE = 4;
+    static constexpr uint32_t TOAST_DEFAULT_MS = 3000;
+    static constexpr uint32_t TOAST_MIN_MS = 800;
+    static constexpr uint32_t FADE_MS = 150;
+    static constexpr uint32_t TICK_MS = 20;
+
+    /**
+     * @brief Construit les objets du pool (à appeler une fois après l'init LVGL)
+     */
+    static void begin(Text* translator);
+
+    /**
+     * @brief Affiche un message temporaire en bas de l'écran
+     * @return false si le message a été rejeté (file pleine)
+     */
+    static bool toast(const char* message, uint32_t duration_ms = TOAST_DEFAULT_MS);
+
+    /**
+     * @brief Demande une confirmation OUI / NON
+     */
+    static bool confirm(const char* question, const char* subject, DialogResult cb, void* ctx = nullptr);
+
+    /**
+     * @brief Affiche une alerte à acquitter
+     */
+    static bool alert(const char* title, const char* message, DialogResult cb = nullptr, void* ctx = nullptr);
+
+    static bool isDialogOpen() { return dialogOpen != NONE; }
+
+    static void printReport(Print& out);
+
+private:
+    enum Kind : uint8_t { NONE, CONFIRM, ALERT };
+    enum ToastState : uint8_t { IDLE, FADE_IN, VISIBLE, FADE_OUT };
+    enum WidgetId : uint8_t { W_YES, W_NO, W_OK };
+
+    struct Dialog {
+        Kind kind;
+        char title[TITLE_LEN];
+        char text[TEXT_LEN];
+        DialogResult cb;
+        void* ctx;
+    };
+
+    struct Toast {
+        char text[TEXT_LEN];
+        uint32_t duration;
+        uint16_t repeat;
+    };
+
+    static Text* translator;
+
+    // Pool d'objets
+    static lv_obj_t* confirmOverlay;
+    static lv_obj_t* confirmQuestion;
+    static lv_obj_t* confirmSubject;
+    static lv_obj_t* confirmYes;
+    static lv_obj_t* confirmNo;
+    static lv_obj_t* alertOverlay;
+    static lv_obj_t* alertTitle;
+    static lv_obj_t* alertText;
+    static lv_obj_t* alertOk;
+    static lv_obj_t* toastBox;
+    static lv_obj_t* toastLabel;
+    static lv_timer_t* toastTimer;
+
+    // Dialogue affiché et file d'attente
+    static Kind dialogOpen;
+    static Dialog currentDialog;
+    static Dialog dialogQueue[DIALOG_QUEUE];
+    static uint8_t dialogHead;
+    static uint8_t dialogCount;
+
+    // Toast affiché et file d'attente
+    static ToastState toastState;
+    static Toast currentToast;
+    static char toastText[TEXT_LEN + 8];
+    static uint32_t toastPhaseStart;
+    static Toast toastQueue[TOAST_QUEUE];
+    static uint8_t toastHead;
+    static uint8_t toastCount;
+
+    // Statistiques
+    static uint32_t postedToasts;
+    static uint32_t shownToasts;
+    static uint32_t mergedToasts;
+    static uint32_t droppedToasts;
+    static uint32_t postedDialogs;
+    static uint32_t droppedDialogs;
+
+    static void buildConfirm();
+    static void buildAlert();
+    static void buildToast();
+
+    static bool queueDialog(Kind kind, const char* title, const char* text, DialogResult cb, void* ctx);
+    static void showNextDialog();
+    static void closeDialog(bool confirmed);
+
+    static void showNextToast();
+    static void refreshToastText();
+
+    static void on_dialog_event(lv_event_t* e);
+    static void on_toast_tick(lv_timer_t* timer);
+};
+
+#endif // NOTIFICATIONS_HPP
@@ -49,6 +49,41 @@ public:
      * Optionnel.
      */
     virtual void onHide() {}
+
+    /**
+     * @brief Libère l'écran LVGL de la page (l'objet Page reste vivant).
+     * Appelé par le cache du PageManager lors d'une éviction.
+     */
+    virtual void destroy() {}
+
+    /**
+     * @brief Indique si l'écran LVGL de la page est actuellement construit.
+     */
+    virtual bool isCreated() const { return false; }
+
+    /**
+     * @brief Construit la page par petites étapes (préchargement en tâche de fond).
+     * Par défaut la page est construite en une seule étape via create().
+     * @return true quand la page est entièrement construite.
+     */
+    virtual bool buildStep() { create(); return true; }
+
+    /**
+     * @brief Indique si une construction par étapes est en cours.
+     */
+    virtual bool isBuilding() const { return false; }
+
+    /**
+     * @brief Sauvegarde l'état des widgets avant destruction de l'écran.
+     * Optionnel.
+     */
+    virtual void saveState() {}
+
+    /**
+     * @brief Restaure l'état sauvegardé après reconstruction de l'écran.
+     * Optionnel.
+     */
+    virtual void restoreState() {}
 };
 
 /**
@@ -74,6 +109,7 @@ enum PageID {
     PAGE_SCREEN = 16,
     PAGE_LANGUAGE = 17,
     PAGE_RESET = 18,
+    PAGE_TOUCH_CALIBRATION = 19,
     PAGE_COUNT
 };
 
@@ -15,67 +15,17 @@
  */
 
 #include "PageManager.hpp"
-#include "../MainDisplayPageLVGL.hpp"
-#include "../SettingsPageLVGL.hpp"
-#include "../CalibrationPHPageLVGL.hpp"
-#include "../CalibrationRedoxPageLVGL.hpp"
-#include "../CloudPageLVGL.hpp"
-#include "../WiFiPageLVGL.hpp"
-#include "../MQTTPageLVGL.hpp"
-#include "../PumpPageLVGL.hpp"
-#include "../SwitchPageLVGL.hpp"
-#include "../LevelProbePageLVGL.hpp"
-#include "../PoolFillPageLVGL.hpp"
-#include "../LockPageLVGL.hpp"
-#include "../ScreenPageLVGL.hpp"
-#include "../LanguagePageLVGL.hpp"
-#include "../ResetPageLVGL.hpp"
+#include "PageRegistry.hpp"
 #include "LVGLPageBase.hpp"
+#include "SharedKeyboard.hpp"
+#include "UiStore.hpp"
+#include "../../screen/LatencyTracker.hpp"
+#include "../../screen/LVGLArena.hpp"
 
 #include <Arduino.h>
 
-PageManager::PageManager() {
+PageManager::PageManager(Text* translator) : translator(translator) {
   for (auto &p : pages) p = nullptr;
-
-  pages[static_cast<size_t>(PageID::PAGE_MAIN_DISPLAY)] = new MainDisplayPageLVGL(this);
-  pages[static_cast<size_t>(PageID::PAGE_SETTINGS)] = new SettingsPageLVGL(this);
-  pages[static_cast<size_t>(PageID::PAGE_CALIBRATION_PH)] = new CalibrationPHPageLVGL(this);
-  pages[static_cast<size_t>(PageID::PAGE_CALIBRATION_REDOX)] = new CalibrationRedoxPageLVGL(this);
-  pages[static_cast<size_t>(PageID::PAGE_CLOUD)] = new CloudPageLVGL(this);
-  pages[static_cast<size_t>(PageID::PAGE_WIFI)] = new WiFiPageLVGL(this);
-  pages[static_cast<size_t>(PageID::PAGE_MQTT)] = new MQTTPageLVGL(this);
-  pages[static_cast<size_t>(PageID::PAGE_PUMP)] = new PumpPageLVGL(this);
-  pages[static_cast<size_t>(PageID::PAGE_SWITCH)] = new SwitchPageLVGL(this);
-  pages[static_cast<size_t>(PageID::PAGE_LEVEL_PROBE)] = new LevelProbePageLVGL(this);
-  pages[static_cast<size_t>(PageID::PAGE_POOL_FILL)] = new PoolFillPageLVGL(this);
-  pages[static_cast<size_t>(PageID::PAGE_LOCK)] = new LockPageLVGL(this);
-  pages[static_cast<size_t>(PageID::PAGE_SCREEN)] = new ScreenPageLVGL(this);
-  pages[static_cast<size_t>(PageID::PAGE_LANGUAGE)] = new LanguagePageLVGL(this);
-  pages[static_cast<size_t>(PageID::PAGE_RESET)] = new ResetPageLVGL(this);
-  
-  setupPageManagerForPages();
-}
-
-void PageManager::setupPageManagerForPages() {
-  for (auto* page : pages) {
-    if (page) {
-      setupPageManagerForPage(page);
-    }
-  }
-}
-
-void PageManager::setupPageManagerForPage(Page* page) {
-  // Essayer de caster vers LVGLPageBase
-  // Comme toutes les pages héritent de Page, on doit vérifier si elles héritent aussi de LVGLPageBase
-  // On utilise un cast multiple pour accéder à LVGLPageBase
-  // Note: Cette approche fonctionne car les pages héritent de Page et LVGLPageBase (héritage multiple)
-  
-  // Pour chaque page qui hérite de LVGLPageBase, on peut utiliser un cast
-  // Mais comme on ne peut pas utiliser dynamic_cast facilement, on va passer le PageManager
-  // dans les constructeurs des pages qui en ont besoin
-  
-  // Pour l'instant, on va utiliser une approche différente : passer this dans les constructeurs
-  // des pages qui héritent de LVGLPageBase
 }
 
 PageManager::~PageManager() {
@@ -83,28 +33,254 @@ PageManager::~PageManager() {
     getCurrentPage()->onHide();
   }
 
+  // Pages live in the registry's static storage: destroy, don't delete
   for (auto* page : pages) {
-    delete page;
+    if (page) page->~Page();
   }
 }
 
+/**
+ * @brief Returns the page for an ID, constructing it on first use.
+ */
+Page* PageManager::getPage(PageID pageId) {
+  size_t idx = static_cast<size_t>(pageId);
+  if (idx >= pages.size()) return nullptr;
+  if (!pages[idx]) {
+    uint32_t start = micros();
+    pages[idx] = PageRegistry::construct(pageId, this, translator);
+    if (pages[idx]) {
+      Serial.printf("[PageManager] Page %d constructed in %lu us\n", (int)pageId,
+                    (unsigned long)(micros() - start));
+    }
+  }
+  return pages[idx];
+}
+
+namespace {
+
+struct PrewarmHint {
+    PageID from;
+    PageID next;
+};
+
+// Pages likely to be opened next from a given page, most likely first
+constexpr PrewarmHint prewarmHints[] = {
+    { PAGE_MAIN_DISPLAY, PAGE_SETTINGS },
+    { PAGE_SETTINGS,     PAGE_PUMP },
+    { PAGE_SETTINGS,     PAGE_CALIBRATION_REDOX },
+    { PAGE_SETTINGS,     PAGE_CALIBRATION_PH },
+    { PAGE_SETTINGS,     PAGE_WIFI },
+    { PAGE_SETTINGS,     PAGE_MQTT },
+    { PAGE_SETTINGS,     PAGE_MAIN_DISPLAY },
+};
+
+static_assert(PAGE_COUNT <= 32, "prewarmedMask holds one bit per page");
+static_assert(PAGE_COUNT <= LVGLArena::MAX_PAGES, "one LVGL arena per page");
+
+} // namespace
+
+/**
+ * @brief Bytes currently allocated in the LVGL heaps (all arenas).
+ */
+static size_t lvglUsedBytes() {
+    lv_mem_monitor_t mon;
+    LVGLArena::monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+static size_t lvglFreeBytes() {
+    lv_mem_monitor_t mon;
+    LVGLArena::monitor(&mon);
+    return mon.free_size;
+}
+
 void PageManager::begin() {
-    setupPageManagerForPages();
-    
-    size_t idx = static_cast<size_t>(currentPageId);
+    if (getPage(currentPageId)) {
+        activatePage(currentPageId, currentPageId);
+    }
+}
 
-    if (pages[idx]) {
-        pages[idx]->onEnter();
-        pages[idx]->create();
-        pages[idx]->show();
-        currentPageShown = true;
+/**
+ * @brief Enters, builds (or reuses) and shows a page, then trims the cache.
+ *
+ * @param pageId Page to show.
+ * @param keepId Page that must not be evicted (the one being left: we may
+ *               still be inside one of its event callbacks).
+ */
+void PageManager::activatePage(PageID pageId, PageID keepId) {
+    size_t idx = static_cast<size_t>(pageId);
+    Page* page = pages[idx];
+
+    LatencyTracker::setPage(static_cast<uint8_t>(pageId));
+    page->onEnter();
+
+    if (prewarmId == pageId) prewarmId = PAGE_COUNT;
+
+    if (page->isCreated()) {
+        cacheHits++;
+        if (prewarmedMask & (1u << idx)) prewarmHits++;
+        // Built pages must not allocate here; if one does, it shows in its own arena
+        LVGLArena::Scope arena(static_cast<uint8_t>(idx));
+        page->create();
+    } else {
+        cacheMisses++;
+        bool partial = page->isBuilding();
+        while (lvglFreeBytes() < PAGE_CACHE_MIN_FREE + pageCost[idx] && evictOne(pageId, keepId)) {}
+
+        size_t before = lvglUsedBytes();
+        uint32_t staticBefore = labelTextStats().staticBytes;
+        {
+            LVGLArena::Scope arena(static_cast<uint8_t>(idx));
+            page->create();
+            page->restoreState();
+        }
+        size_t after = lvglUsedBytes();
+        pageCost[idx] = (partial ? pageCost[idx] : 0) + (after > before ? after - before : 0);
+        pageStaticText[idx] = (partial ? pageStaticText[idx] : 0) + (labelTextStats().staticBytes - staticBefore);
+    }
+    prewarmedMask &= ~(1u << idx);
+    lastUsed[idx] = ++useCounter;
+
+    page->show();
+    currentPageShown = true;
+    UiStore::setActivePage(page);
+
+    while (cachedBytes(pageId, keepId) > cacheBudget && evictOne(pageId, keepId)) {}
+}
+
+size_t PageManager::cachedBytes(PageID exceptA, PageID exceptB) const {
+    size_t total = 0;
+    for (size_t i = 0; i < pages.size(); i++) {
+        if (i == static_cast<size_t>(exceptA) || i == static_cast<size_t>(exceptB)) continue;
+        // Half-prewarmed pages already hold their built parts
+        if (pages[i] && (pages[i]->isCreated() || pages[i]->isBuilding())) total += pageCost[i];
+    }
+    return total;
+}
+
+/**
+ * @brief Destroys the least recently used built or half-built page, except the two given.
+ * @return false when nothing could be evicted.
+ */
+bool PageManager::evictOne(PageID keepA, PageID keepB) {
+    size_t victim = pages.size();
+    for (size_t i = 0; i < pages.size(); i++) {
+        if (i == static_cast<size_t>(keepA) || i == static_cast<size_t>(keepB)) continue;
+        if (!pages[i] || !(pages[i]->isCreated() || pages[i]->isBuilding())) continue;
+        if (victim == pages.size() || lastUsed[i] < lastUsed[victim]) victim = i;
+    }
+    if (victim == pages.size()) return false;
+
+    size_t before = lvglUsedBytes();
+    pages[victim]->destroy();
+    LVGLArena::release(static_cast<uint8_t>(victim));
+    prewarmedMask &= ~(1u << victim);
+    if (victim == static_cast<size_t>(prewarmId)) prewarmId = PAGE_COUNT;
+    cacheEvictions++;
+    Serial.printf("[PageManager] Evicted page %d (%u bytes freed)\n",
+                  (int)victim, (unsigned)(before - lvglUsedBytes()));
+    return true;
+}
+
+void PageManager::printCacheReport(Print& out) const {
+    lv_mem_monitor_t mon;
+    LVGLArena::monitor(&mon);
+
+    out.printf("=== Page cache ===\n");
+    size_t constructed = 0;
+    for (auto* page : pages) if (page) constructed++;
+    out.printf("pages constructed %u\n", (unsigned)constructed);
+    out.printf("hits %lu  misses %lu  evictions %lu\n",
+               (unsigned long)cacheHits, (unsigned long)cacheMisses, (unsigned long)cacheEvictions);
+    out.printf("prewarmed %lu  used after prewarm %lu\n",
+               (unsigned long)prewarmBuilt, (unsigned long)prewarmHits);
+    out.printf("cached %u / budget %u bytes\n",
+               (unsigned)cachedBytes(currentPageId, currentPageId), (unsigned)cacheBudget);
+    out.printf("LVGL heap: used %u  free %u  biggest free %u  frag %u%%\n",
+               (unsigned)(mon.total_size - mon.free_size), (unsigned)mon.free_size,
+               (unsigned)mon.free_biggest_size, (unsigned)mon.frag_pct);
+    for (size_t i = 0; i < pages.size(); i++) {
+        if (!pages[i] || !pageCost[i]) continue;
+        out.printf("  page %2u  %6u bytes  %4u text not copied  %s%s\n", (unsigned)i, (unsigned)pageCost[i],
+                   (unsigned)pageStaticText[i], pages[i]->isCreated() ? "built" : "evicted",
+                   i == static_cast<size_t>(currentPageId) ? " (current)" : "");
     }
+    const LabelTextStats& text = labelTextStats();
+    out.printf("label text: %lu static (%lu bytes not copied), %lu copied (%lu bytes)\n",
+               (unsigned long)text.staticLabels, (unsigned long)text.staticBytes,
+               (unsigned long)text.copiedLabels, (unsigned long)text.copiedBytes);
 }
 
 void PageManager::loop() {
     // loop() ne doit PAS appeler show() à chaque fois
     // show() est appelé uniquement lors de la création ou du changement de page
-    // Cette méthode peut être utilisée pour d'autres mises à jour périodiques si nécessaire
+    // Quand l'utilisateur ne touche pas l'écran, on précharge les pages probables
+    if (lv_disp_get_inactive_time(nullptr) < PAGE_PREWARM_IDLE_MS) return;
+    prewarmSlice();
+}
+
+/**
+ * @brief Picks the next page to prewarm from the current page's hints,
+ * if it fits the cache budget.
+ * @return PAGE_COUNT when there is nothing to do.
+ */
+PageID PageManager::nextPrewarmTarget() const {
+    for (const auto& hint : prewarmHints) {
+        if (hint.from != currentPageId || !PageRegistry::exists(hint.next)) continue;
+
+        size_t idx = static_cast<size_t>(hint.next);
+        if (pages[idx] && (pages[idx]->isCreated() || pages[idx]->isBuilding())) continue;
+
+        if (cachedBytes(currentPageId, currentPageId) + pageCost[idx] > cacheBudget) return PAGE_COUNT;
+        if (lvglFreeBytes() < PAGE_CACHE_MIN_FREE + pageCost[idx]) return PAGE_COUNT;
+        return hint.next;
+    }
+    return PAGE_COUNT;
+}
+
+/**
+ * @brief Runs page build steps for at most PAGE_PREWARM_SLICE_US.
+ */
+void PageManager::prewarmSlice() {
+    uint32_t start = micros();
+
+    do {
+        if (prewarmId == PAGE_COUNT) {
+            prewarmId = nextPrewarmTarget();
+            if (prewarmId == PAGE_COUNT) return;
+        }
+
+        size_t idx = static_cast<size_t>(prewarmId);
+        Page* page = getPage(prewarmId);
+        if (!page) {
+            prewarmId = PAGE_COUNT;
+            return;
+        }
+
+        if (!page->isBuilding()) {
+            pageCost[idx] = 0;
+            pageStaticText[idx] = 0;
+        }
+        size_t before = lvglUsedBytes();
+        uint32_t staticBefore = labelTextStats().staticBytes;
+        bool done;
+        {
+            LVGLArena::Scope arena(static_cast<uint8_t>(idx));
+            done = page->buildStep();
+            if (done) page->restoreState();
+        }
+        size_t after = lvglUsedBytes();
+        if (after > before) pageCost[idx] += after - before;
+        pageStaticText[idx] += labelTextStats().staticBytes - staticBefore;
+
+        if (done) {
+            lastUsed[idx] = useCounter;
+            prewarmedMask |= 1u << idx;
+            prewarmBuilt++;
+            Serial.printf("[PageManager] Prewarmed page %d (%u bytes)\n", (int)prewarmId, (unsigned)pageCost[idx]);
+            prewarmId = PAGE_COUNT;
+        }
+    } while (micros() - start < PAGE_PREWARM_SLICE_US);
 }
 
 
@@ -112,22 +288,22 @@ void PageManager::navigateToPage(PageID pageId) {
     size_t oldIdx = static_cast<size_t>(currentPageId);
     size_t newIdx = static_cast<size_t>(pageId);
 
-    if (newIdx >= pages.size() || !pages[newIdx]) {
+    if (newIdx >= pages.size() || !getPage(pageId)) {
         Serial.printf("[PageManager] ERROR: Invalid page ID %d or page is NULL\n", (int)pageId);
         return;
     }
 
     Serial.printf("[PageManager] Navigating from page %d to page %d\n", (int)currentPageId, (int)pageId);
 
+    // The keyboard may point into the page being left, which can be evicted
+    SharedKeyboard::close(false);
     if (pages[oldIdx]) pages[oldIdx]->onExit();
 
+    PageID oldId = currentPageId;
     currentPageId = pageId;
     currentPageShown = false;
 
-    pages[newIdx]->onEnter();
-    pages[newIdx]->create();
-    pages[newIdx]->show();
-    currentPageShown = true;
+    activatePage(pageId, oldId);
     
     Serial.printf("[PageManager] Navigation complete to page %d\n", (int)pageId);
 }
@@ -19,14 +19,43 @@
 
 #include "Page.hpp"
 #include <array>
+#include <cstddef>
 #include <cstdint>
 
+/**
+ * @brief LVGL heap bytes that built-but-hidden screens may keep (override
+ * with -DPAGE_CACHE_BUDGET=...). Least recently used screens are deleted
+ * beyond this.
+ */
+#ifndef PAGE_CACHE_BUDGET
+#define PAGE_CACHE_BUDGET (20 * 1024)
+#endif
+
+/**
+ * @brief Minimum free LVGL heap kept before building a page that is not cached.
+ */
+#ifndef PAGE_CACHE_MIN_FREE
+#define PAGE_CACHE_MIN_FREE (8 * 1024)
+#endif
+
+/**
+ * @brief Idle time (no touch) before pages are prewarmed, and time spent
+ * prewarming per loop() call.
+ */
+#ifndef PAGE_PREWARM_IDLE_MS
+#define PAGE_PREWARM_IDLE_MS 800
+#endif
+#ifndef PAGE_PREWARM_SLICE_US
+#define PAGE_PREWARM_SLICE_US 4000
+#endif
 
 class LVGLPageBase;
+class Print;
+class Text;
 
 class PageManager {
 public:
-    PageManager();
+    explicit PageManager(Text* translator);
     ~PageManager();
 
 
@@ -35,13 +64,41 @@ public:
     void navigateToPage(PageID pageId);
     Page* getCurrentPage() const;
     PageID getCurrentPageId() const { return currentPageId; }
-    void setupPageManagerForPages();
+
+    void setCacheBudget(size_t bytes) { cacheBudget = bytes; }
+    void printCacheReport(Print& out) const;
 
 private:
     PageID currentPageId = PageID::PAGE_MAIN_DISPLAY;
     std::array<Page*, PAGE_COUNT> pages{};
+    Text* translator;
     bool currentPageShown = false;
-    void setupPageManagerForPage(Page* page);
+
+    Page* getPage(PageID pageId);
+
+    // Page cache: LVGL cost of each built screen and LRU stamps
+    size_t cacheBudget = PAGE_CACHE_BUDGET;
+    std::array<size_t, PAGE_COUNT> pageCost{};
+    std::array<uint32_t, PAGE_COUNT> lastUsed{};
+    // Label text bytes each page references from flash instead of copying
+    std::array<uint32_t, PAGE_COUNT> pageStaticText{};
+    uint32_t useCounter = 0;
+    uint32_t cacheHits = 0;
+    uint32_t cacheMisses = 0;
+    uint32_t cacheEvictions = 0;
+
+    // Idle prewarming of the pages likely to be opened next
+    PageID prewarmId = PAGE_COUNT;
+    uint32_t prewarmedMask = 0;
+    uint32_t prewarmBuilt = 0;
+    uint32_t prewarmHits = 0;
+
+    PageID nextPrewarmTarget() const;
+    void prewarmSlice();
+
+    void activatePage(PageID pageId, PageID keepId);
+    size_t cachedBytes(PageID exceptA, PageID exceptB) const;
+    bool evictOne(PageID keepA, PageID keepB);
 };
 
 #endif // PAGE_MANAGER_HPP
@@ -0,0 +1,102 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   PageRegistry.cpp                               :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 14:02:11 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 14:02:11 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file PageRegistry.cpp
+ * @brief Page factory table and static page storage.
+ */
+
+#include "PageRegistry.hpp"
+#include "../MainDisplayPageLVGL.hpp"
+#include "../SettingsPageLVGL.hpp"
+#include "../CalibrationPHPageLVGL.hpp"
+#include "../CalibrationRedoxPageLVGL.hpp"
+#include "../CloudPageLVGL.hpp"
+#include "../WiFiPageLVGL.hpp"
+#include "../MQTTPageLVGL.hpp"
+#include "../PumpPageLVGL.hpp"
+#include "../SwitchPageLVGL.hpp"
+#include "../LevelProbePageLVGL.hpp"
+#include "../PoolFillPageLVGL.hpp"
+#include "../LockPageLVGL.hpp"
+#include "../ScreenPageLVGL.hpp"
+#include "../LanguagePageLVGL.hpp"
+#include "../ResetPageLVGL.hpp"
+#include "../TouchCalibrationPageLVGL.hpp"
+#include "../../Translation/text.hpp"
+
+#include <new>
+
+namespace {
+
+// Pages with a static setGlobalTranslator() get the translator, others are skipped
+template <typename T>
+auto injectTranslator(Text* translator, int) -> decltype(T::setGlobalTranslator(translator), void()) {
+    T::setGlobalTranslator(translator);
+}
+
+template <typename T>
+void injectTranslator(Text*, long) {}
+
+template <typename T>
+Page* makePage(PageManager* mgr, Text* translator) {
+    alignas(T) static unsigned char storage[sizeof(T)];
+    injectTranslator<T>(translator, 0);
+    return new (storage) T(mgr);
+}
+
+struct PageEntry {
+    PageID id;
+    Page* (*factory)(PageManager*, Text*);
+};
+
+constexpr PageEntry registry[] = {
+    { PAGE_STARTUP,                nullptr },
+    { PAGE_MAIN_DISPLAY,           &makePage<MainDisplayPageLVGL> },
+    { static_cast<PageID>(2),      nullptr },
+    { PAGE_SETTINGS,               &makePage<SettingsPageLVGL> },
+    { PAGE_CALIBRATION_PH,         &makePage<CalibrationPHPageLVGL> },
+    { PAGE_CALIBRATION_REDOX,      &makePage<CalibrationRedoxPageLVGL> },
+    { PAGE_ALERT,                  nullptr },
+    { PAGE_INFO,                   nullptr },
+    { PAGE_CLOUD,                  &makePage<CloudPageLVGL> },
+    { PAGE_WIFI,                   &makePage<WiFiPageLVGL> },
+    { PAGE_MQTT,                   &makePage<MQTTPageLVGL> },
+    { PAGE_PUMP,                   &makePage<PumpPageLVGL> },
+    { PAGE_SWITCH,                 &makePage<SwitchPageLVGL> },
+    { PAGE_LEVEL_PROBE,            &makePage<LevelProbePageLVGL> },
+    { PAGE_POOL_FILL,              &makePage<PoolFillPageLVGL> },
+    { PAGE_LOCK,                   &makePage<LockPageLVGL> },
+    { PAGE_SCREEN,                 &makePage<ScreenPageLVGL> },
+    { PAGE_LANGUAGE,               &makePage<LanguagePageLVGL> },
+    { PAGE_RESET,                  &makePage<ResetPageLVGL> },
+    { PAGE_TOUCH_CALIBRATION,      &makePage<TouchCalibrationPageLVGL> },
+};
+
+constexpr size_t REGISTRY_SIZE = sizeof(registry) / sizeof(registry[0]);
+
+constexpr bool isIndexedById(size_t i = 0) {
+    return i == REGISTRY_SIZE || (registry[i].id == static_cast<PageID>(i) && isIndexedById(i + 1));
+}
+
+static_assert(REGISTRY_SIZE == PAGE_COUNT, "page registry needs one entry per PageID");
+static_assert(isIndexedById(), "page registry entries must be in PageID order");
+
+} // namespace
+
+Page* PageRegistry::construct(PageID id, PageManager* mgr, Text* translator) {
+    if (!exists(id)) return nullptr;
+    return registry[id].factory(mgr, translator);
+}
+
+bool PageRegistry::exists(PageID id) {
+    return static_cast<size_t>(id) < REGISTRY_SIZE && registry[id].factory != nullptr;
+}
@@ -0,0 +1,46 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   PageRegistry.hpp                               :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 14:02:11 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 14:02:11 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file PageRegistry.hpp
+ * @brief Compile-time table of page factories indexed by PageID.
+ */
+
+#ifndef PAGE_REGISTRY_HPP
+#define PAGE_REGISTRY_HPP
+
+#include "Page.hpp"
+
+class PageManager;
+class Text;
+
+/**
+ * @class PageRegistry
+ * @brief Builds page objects on demand in static storage.
+ *
+ * Each page class gets its own statically allocated slot, so pages are
+ * constructed on first navigation without touching the heap. The shared
+ * translator and the PageManager are injected at construction.
+ */
+class PageRegistry {
+public:
+    /**
+     * @brief Constructs the page for an ID. Must be called at most once
+     * per ID, the PageManager keeps the returned pointer.
+     * @return The page, or nullptr if no page is registered for this ID.
+     */
+    static Page* construct(PageID id, PageManager* mgr, Text* translator);
+
+    /** @brief True if a page class is registered for this ID. */
+    static bool exists(PageID id);
+};
+
+#endif // PAGE_REGISTRY_HPP
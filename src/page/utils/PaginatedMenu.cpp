@@ -0,0 +1,182 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   PaginatedMenu.cpp                              :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 22:05:12 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 22:05:12 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file PaginatedMenu.cpp
+ * @brief Paginated navigation rows bound to a constexpr MenuEntry table.
+ */
+
+#include "PaginatedMenu.hpp"
+#include "interface-utils-lvgl.hpp"
+#include <Arduino.h>
+
+PaginatedMenu::PaginatedMenu()
+    : entries(nullptr), count(0), pages(0), current(0), idBase(0), boundLanguage(-1),
+      labels{}, rows{}, rowLabels{}, btnPrevious(nullptr), btnNext(nullptr),
+      indicator(nullptr), footer(nullptr), indicatorText{} {
+}
+
+void PaginatedMenu::setEntries(const MenuEntry* table, uint8_t entryCount, uint8_t base) {
+    entries = table;
+    count = entryCount;
+    pages = static_cast<uint8_t>((entryCount + ROWS - 1) / ROWS);
+    current = 0;
+    idBase = base;
+    boundLanguage = -1;
+}
+
+/**
+ * @brief Creates the previous / next buttons and the page indicator.
+ * @param parent Parent object (the page screen).
+ * @return False if no table is set.
+ */
+bool PaginatedMenu::createNavigation(lv_obj_t* parent) {
+    if (!entries || !parent) {
+        Serial.println("[PaginatedMenu] ERROR: no entries or parent in createNavigation()");
+        return false;
+    }
+
+    btnPrevious = createButton(parent, 53, 260, 120, 50, "<", LVGLStyles::COLOR_TEXT_SECONDARY);
+    setWidgetId(btnPrevious, idBase + ID_PREVIOUS);
+
+    btnNext = createButton(parent, 307, 260, 120, 50, ">", LVGLStyles::COLOR_TEXT_SECONDARY);
+    setWidgetId(btnNext, idBase + ID_NEXT);
+
+    indicator = createLabel(parent, 190, 275, "", LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_SECONDARY);
+    lv_label_set_text_static(indicator, indicatorText);
+    return true;
+}
+
+/**
+ * @brief Creates the row cards and the footer label, all hidden until setPage().
+ * @param parent Parent object (the page content area).
+ * @param footerText Static text shown on the last page only, or nullptr.
+ * @return False if no table is set.
+ */
+bool PaginatedMenu::createRows(lv_obj_t* parent, const char* footerText) {
+    if (!entries || !parent) {
+        Serial.println("[PaginatedMenu] ERROR: no entries or parent in createRows()");
+        return false;
+    }
+
+    for (uint8_t i = 0; i < ROWS; i++) {
+        rows[i] = createCard(parent, 0, i * 65, 440, 60);
+        lv_obj_add_flag(rows[i], LV_OBJ_FLAG_CLICKABLE);
+        setWidgetId(rows[i], idBase + ID_ROW_0 + i);
+        rowLabels[i] = createLabel(rows[i], 10, 20, "", LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
+        lv_obj_add_flag(rows[i], LV_OBJ_FLAG_HIDDEN);
+    }
+
+    if (footerText) {
+        footer = createLabel(parent, 0, 150, "", LVGLStyles::FONT_SMALL, LVGLStyles::COLOR_TEXT_SECONDARY);
+        lv_label_set_text_static(footer, footerText);
+        lv_obj_align(footer, LV_ALIGN_BOTTOM_MID, 0, -10);
+        lv_obj_add_flag(footer, LV_OBJ_FLAG_HIDDEN);
+    }
+    return true;
+}
+
+/**
+ * @brief Resolves every entry label for a language, then rebinds the visible rows.
+ * Does nothing if the menu is already bound to this language.
+ * @param lang Display language.
+ */
+void PaginatedMenu::bindLanguage(Text::Language lang) {
+    if (boundLanguage == static_cast<int8_t>(lang)) return;
+
+    for (uint8_t i = 0; i < count; i++) {
+        labels[i] = Text::get(entries[i].text, lang);
+    }
+    boundLanguage = static_cast<int8_t>(lang);
+    bindRows();
+}
+
+/**
+ * @brief Shows a page of the menu.
+ * @param page Page index, clamped to the last page.
+ */
+void PaginatedMenu::setPage(uint8_t page) {
+    if (pages == 0) return;
+    current = page < pages ? page : pages - 1;
+    bindRows();
+    updateNavigation();
+}
+
+bool PaginatedMenu::next() {
+    if (current + 1 >= pages) return false;
+    setPage(current + 1);
+    return true;
+}
+
+bool PaginatedMenu::previous() {
+    if (current == 0) return false;
+    setPage(current - 1);
+    return true;
+}
+
+/**
+ * @brief Points the row labels at the resolved labels of the current page.
+ */
+void PaginatedMenu::bindRows() {
+    if (boundLanguage < 0 || !rows[0]) return;
+
+    for (uint8_t i = 0; i < ROWS; i++) {
+        uint8_t entry = current * ROWS + i;
+        if (entry < count) {
+            lv_label_set_text_static(rowLabels[i], labels[entry]);
+            lv_obj_clear_flag(rows[i], LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_add_flag(rows[i], LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+    if (footer) {
+        if (current == pages - 1) lv_obj_clear_flag(footer, LV_OBJ_FLAG_HIDDEN);
+        else lv_obj_add_flag(footer, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+/**
+ * @brief Updates the page indicator and the enabled state of the buttons.
+ */
+void PaginatedMenu::updateNavigation() {
+    if (!btnPrevious || !btnNext || !indicator) return;
+
+    snprintf(indicatorText, sizeof(indicatorText), "%u/%u", (unsigned)(current + 1), (unsigned)pages);
+    lv_label_set_text_static(indicator, indicatorText);
+
+    if (current > 0) {
+        lv_obj_set_style_bg_color(btnPrevious, LVGLStyles::color(LVGLStyles::COLOR_PRIMARY), 0);
+        lv_obj_clear_state(btnPrevious, LV_STATE_DISABLED);
+    } else {
+        lv_obj_set_style_bg_color(btnPrevious, LVGLStyles::color(LVGLStyles::COLOR_TEXT_SECONDARY), 0);
+        lv_obj_add_state(btnPrevious, LV_STATE_DISABLED);
+    }
+
+    if (current + 1 < pages) {
+        lv_obj_set_style_bg_color(btnNext, LVGLStyles::color(LVGLStyles::COLOR_PRIMARY), 0);
+        lv_obj_clear_state(btnNext, LV_STATE_DISABLED);
+    } else {
+        lv_obj_set_style_bg_color(btnNext, LVGLStyles::color(LVGLStyles::COLOR_TEXT_SECONDARY), 0);
+        lv_obj_add_state(btnNext, LV_STATE_DISABLED);
+    }
+}
+
+/**
+ * @brief Target page of a tagged row.
+ * @param id Widget id of the clicked row.
+ * @return PageID of the entry, or -1 if the id is not a filled row.
+ */
+int PaginatedMenu::targetOf(uint8_t id) const {
+    if (id < idBase + ID_ROW_0 || id >= idBase + ID_COUNT) return -1;
+    uint8_t entry = current * ROWS + (id - idBase - ID_ROW_0);
+    if (entry >= count) return -1;
+    return entries[entry].page;
+}
@@ -0,0 +1,122 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   PaginatedMenu.hpp                              :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 22:05:12 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 22:05:12 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file PaginatedMenu.hpp
+ * @brief Menu of navigation rows split into pages, driven by a constexpr table.
+ */
+
+#ifndef PAGINATED_MENU_HPP
+#define PAGINATED_MENU_HPP
+
+#include <lvgl.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "Page.hpp"
+#include "../../Translation/text.hpp"
+
+/**
+ * @brief Entrée constexpr d'un menu : libellé traduit et page cible
+ */
+struct MenuEntry {
+    StrId text;
+    PageID page;
+};
+
+/**
+ * @class PaginatedMenu
+ * @brief Lignes de navigation paginées (ROWS lignes par page) + boutons < / >.
+ *
+ * Les lignes, les boutons, l'indicateur de page et le pied de page sont créés
+ * une seule fois. Les libellés sont résolus une fois par langue (bindLanguage)
+ * et pointent vers la flash : changer de page ne fait que relier les ROWS
+ * lignes à d'autres entrées, sans traduction ni allocation.
+ *
+ * Identifiants de widgets : idBase + ID_PREVIOUS, ID_NEXT, ID_ROW_0 + ligne.
+ */
+class PaginatedMenu {
+public:
+    static constexpr uint8_t ROWS = 3;
+    static constexpr uint8_t MAX_ENTRIES = 24;
+
+    enum WidgetOffset : uint8_t {
+        ID_PREVIOUS = 0,
+        ID_NEXT,
+        ID_ROW_0,
+        ID_COUNT = ID_ROW_0 + ROWS
+    };
+
+    PaginatedMenu();
+
+    /**
+     * @brief Associe la table du menu (avant createNavigation / createRows)
+     */
+    template <size_t N>
+    void setEntries(const MenuEntry (&table)[N], uint8_t idBase) {
+        static_assert(N > 0 && N <= MAX_ENTRIES, "PaginatedMenu: table size out of range");
+        setEntries(table, static_cast<uint8_t>(N), idBase);
+    }
+
+    /**
+     * @brief Crée les boutons précédent / suivant et l'indicateur de page
+     */
+    bool createNavigation(lv_obj_t* parent);
+
+    /**
+     * @brief Crée les ROWS lignes et le pied de page (masqués)
+     * @param footerText Texte statique affiché sur la dernière page, ou nullptr
+     */
+    bool createRows(lv_obj_t* parent, const char* footerText);
+
+    /**
+     * @brief Résout les libellés pour une langue (sans effet si déjà liée)
+     */
+    void bindLanguage(Text::Language lang);
+
+    /**
+     * @brief Affiche une page : relie les lignes, l'indicateur et les boutons
+     */
+    void setPage(uint8_t page);
+
+    bool next();
+    bool previous();
+
+    /**
+     * @brief Page cible de la ligne identifiée par id, -1 si vide ou hors menu
+     */
+    int targetOf(uint8_t id) const;
+
+    uint8_t page() const { return current; }
+    uint8_t pageCount() const { return pages; }
+
+private:
+    void setEntries(const MenuEntry* table, uint8_t count, uint8_t idBase);
+    void bindRows();
+    void updateNavigation();
+
+    const MenuEntry* entries;
+    uint8_t count;
+    uint8_t pages;
+    uint8_t current;
+    uint8_t idBase;
+    int8_t boundLanguage;
+    const char* labels[MAX_ENTRIES];
+
+    lv_obj_t* rows[ROWS];
+    lv_obj_t* rowLabels[ROWS];
+    lv_obj_t* btnPrevious;
+    lv_obj_t* btnNext;
+    lv_obj_t* indicator;
+    lv_obj_t* footer;
+    char indicatorText[8];
+};
+
+#endif
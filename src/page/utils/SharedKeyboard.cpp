@@ -0,0 +1,201 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   SharedKeyboard.cpp                             :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 20:58:03 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 20:58:03 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file SharedKeyboard.cpp
+ * @brief Lazy shared keyboard on the top layer with input mode presets.
+ */
+
+#include "SharedKeyboard.hpp"
+#include <Arduino.h>
+
+lv_obj_t* SharedKeyboard::keyboard = nullptr;
+lv_obj_t* SharedKeyboard::target = nullptr;
+lv_obj_t* SharedKeyboard::shifted = nullptr;
+lv_coord_t SharedKeyboard::shift = 0;
+
+// Space kept between the text area and the top of the keyboard
+static constexpr lv_coord_t INPUT_MARGIN = 8;
+
+// URL preset: lower case letters with the URL punctuation on the main keys
+static const char* urlMap[] = {
+    "1", "2", "3", "4", "5", "6", "7", "8", "9", "0", LV_SYMBOL_BACKSPACE, "\n",
+    "q", "w", "e", "r", "t", "y", "u", "i", "o", "p", "/", "\n",
+    "a", "s", "d", "f", "g", "h", "j", "k", "l", ":", "\n",
+    "z", "x", "c", "v", "b", "n", "m", ".", "-", "_", "\n",
+    LV_SYMBOL_KEYBOARD, "https://", ".com", LV_SYMBOL_LEFT, LV_SYMBOL_RIGHT, LV_SYMBOL_OK, ""
+};
+
+static const lv_btnmatrix_ctrl_t urlCtrlMap[] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, LV_KEYBOARD_CTRL_BTN_FLAGS | 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    LV_KEYBOARD_CTRL_BTN_FLAGS | 2, 3, 2, LV_KEYBOARD_CTRL_BTN_FLAGS | 1,
+    LV_KEYBOARD_CTRL_BTN_FLAGS | 1, LV_KEYBOARD_CTRL_BTN_FLAGS | 2
+};
+
+static_assert(sizeof(urlCtrlMap) / sizeof(urlCtrlMap[0]) ==
+              sizeof(urlMap) / sizeof(urlMap[0]) - 1 - 4,
+              "urlCtrlMap needs one entry per key (no entry for line breaks and the terminator)");
+
+/**
+ * @brief Creates the keyboard on the top layer on first use.
+ */
+void SharedKeyboard::ensureCreated() {
+    if (keyboard) return;
+
+    uint32_t start = micros();
+    keyboard = lv_keyboard_create(lv_layer_top());
+    lv_obj_set_size(keyboard, lv_pct(100), HEIGHT);
+    lv_obj_set_pos(keyboard, 0, lv_disp_get_ver_res(nullptr));
+    lv_keyboard_set_map(keyboard, LV_KEYBOARD_MODE_USER_1, urlMap, urlCtrlMap);
+    lv_obj_add_event_cb(keyboard, on_keyboard_event, LV_EVENT_ALL, nullptr);
+    lv_obj_add_flag(keyboard, LV_OBJ_FLAG_HIDDEN);
+    Serial.printf("[SharedKeyboard] Created in %lu us\n", (unsigned long)(micros() - start));
+}
+
+/**
+ * @brief Shows the keyboard for a text area.
+ * @param textarea Text area receiving the input.
+ * @param mode Keyboard preset.
+ */
+void SharedKeyboard::open(lv_obj_t* textarea, InputMode mode) {
+    if (!textarea) return;
+    ensureCreated();
+
+    switch (mode) {
+        case InputMode::NUMBER:
+            lv_keyboard_set_mode(keyboard, LV_KEYBOARD_MODE_NUMBER);
+            break;
+        case InputMode::URL:
+            lv_keyboard_set_mode(keyboard, LV_KEYBOARD_MODE_USER_1);
+            break;
+        default:
+            lv_keyboard_set_mode(keyboard, LV_KEYBOARD_MODE_TEXT_LOWER);
+            break;
+    }
+
+    if (target == textarea) return;
+
+    bool wasOpen = target != nullptr;
+    if (shifted) setShift(shifted, 0, false);
+    target = textarea;
+    lv_keyboard_set_textarea(keyboard, textarea);
+
+    // Move the page object holding the text area above the keyboard if needed
+    lv_coord_t keyboardTop = lv_disp_get_ver_res(nullptr) - HEIGHT;
+    lv_area_t area;
+    lv_obj_update_layout(textarea);
+    lv_obj_get_coords(textarea, &area);
+    lv_coord_t needed = area.y2 + INPUT_MARGIN - keyboardTop;
+    if (needed > 0) {
+        lv_obj_t* top = textarea;
+        while (lv_obj_get_parent(top) && lv_obj_get_parent(lv_obj_get_parent(top))) {
+            top = lv_obj_get_parent(top);
+        }
+        setShift(top, -needed, true);
+    }
+
+    if (!wasOpen) {
+        lv_anim_del(keyboard, anim_set_y);
+        lv_obj_clear_flag(keyboard, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_move_foreground(keyboard);
+
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, keyboard);
+        lv_anim_set_exec_cb(&a, anim_set_y);
+        lv_anim_set_values(&a, lv_obj_get_y(keyboard), keyboardTop);
+        lv_anim_set_time(&a, ANIM_MS);
+        lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+        lv_anim_start(&a);
+    }
+}
+
+/**
+ * @brief Hides the keyboard and moves the page back.
+ * @param animate False when leaving the page: its objects may be deleted
+ *                right after, so no animation may keep pointers to them.
+ */
+void SharedKeyboard::close(bool animate) {
+    if (!keyboard || !target) return;
+
+    target = nullptr;
+    lv_keyboard_set_textarea(keyboard, nullptr);
+    if (shifted) setShift(shifted, 0, animate);
+
+    lv_anim_del(keyboard, anim_set_y);
+    lv_coord_t bottom = lv_disp_get_ver_res(nullptr);
+    if (!animate) {
+        lv_obj_set_y(keyboard, bottom);
+        lv_obj_add_flag(keyboard, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, keyboard);
+    lv_anim_set_exec_cb(&a, anim_set_y);
+    lv_anim_set_values(&a, lv_obj_get_y(keyboard), bottom);
+    lv_anim_set_time(&a, ANIM_MS);
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_in);
+    lv_anim_set_ready_cb(&a, on_hidden);
+    lv_anim_start(&a);
+}
+
+/**
+ * @brief Moves a page object vertically with translate_y (no layout update).
+ * @param obj Top level page object.
+ * @param to Target translation (0 restores the page).
+ * @param animate Animate the move.
+ */
+void SharedKeyboard::setShift(lv_obj_t* obj, lv_coord_t to, bool animate) {
+    lv_anim_del(obj, anim_set_translate_y);
+    if (!animate) {
+        lv_obj_set_style_translate_y(obj, to, 0);
+    } else {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, obj);
+        lv_anim_set_exec_cb(&a, anim_set_translate_y);
+        lv_anim_set_values(&a, shift, to);
+        lv_anim_set_time(&a, ANIM_MS);
+        lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+        lv_anim_start(&a);
+    }
+    shift = to;
+    shifted = to ? obj : nullptr;
+}
+
+/**
+ * @brief Closes the keyboard on OK (READY) or on the keyboard key (CANCEL).
+ * @param e LVGL event.
+ */
+void SharedKeyboard::on_keyboard_event(lv_event_t* e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    if (code == LV_EVENT_READY || code == LV_EVENT_CANCEL) {
+        close(true);
+    }
+}
+
+void SharedKeyboard::anim_set_y(void* obj, int32_t v) {
+    lv_obj_set_y((lv_obj_t*)obj, (lv_coord_t)v);
+}
+
+void SharedKeyboard::anim_set_translate_y(void* obj, int32_t v) {
+    lv_obj_set_style_translate_y((lv_obj_t*)obj, (lv_coord_t)v, 0);
+}
+
+void SharedKeyboard::on_hidden(lv_anim_t* a) {
+    // Reopened while sliding out: keep it visible
+    if (!target) lv_obj_add_flag((lv_obj_t*)a->var, LV_OBJ_FLAG_HIDDEN);
+}
@@ -0,0 +1,66 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   SharedKeyboard.hpp                             :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 20:58:03 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 20:58:03 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file SharedKeyboard.hpp
+ * @brief Single on-screen keyboard shared by every text area.
+ */
+
+#ifndef SHARED_KEYBOARD_HPP
+#define SHARED_KEYBOARD_HPP
+
+#include <lvgl.h>
+#include "interface-utils-lvgl.hpp"
+
+/**
+ * @class SharedKeyboard
+ * @brief Clavier unique, créé au premier besoin sur lv_layer_top().
+ *
+ * Il est rattaché à la zone de texte touchée et glisse depuis le bas de
+ * l'écran. La page n'est pas remise en page : si la zone de texte serait
+ * cachée, l'objet de premier niveau qui la contient est seulement décalé
+ * (translate_y) le temps de la saisie.
+ */
+class SharedKeyboard {
+public:
+    static constexpr lv_coord_t HEIGHT = 150;
+    static constexpr uint16_t ANIM_MS = 180;
+
+    /**
+     * @brief Affiche le clavier pour une zone de texte avec le préréglage donné
+     */
+    static void open(lv_obj_t* textarea, InputMode mode);
+
+    /**
+     * @brief Cache le clavier et rend sa position à la page
+     * @param animate false lors d'un changement de page (objets bientôt supprimés)
+     */
+    static void close(bool animate = true);
+
+    static bool isOpen() { return target != nullptr; }
+    static lv_obj_t* textarea() { return target; }
+
+private:
+    static lv_obj_t* keyboard;
+    static lv_obj_t* target;
+    static lv_obj_t* shifted;
+    static lv_coord_t shift;
+
+    static void ensureCreated();
+    static void setShift(lv_obj_t* obj, lv_coord_t to, bool animate);
+
+    static void on_keyboard_event(lv_event_t* e);
+    static void anim_set_y(void* obj, int32_t v);
+    static void anim_set_translate_y(void* obj, int32_t v);
+    static void on_hidden(lv_anim_t* a);
+};
+
+#endif // SHARED_KEYBOARD_HPP
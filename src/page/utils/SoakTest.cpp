@@ -0,0 +1,236 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   SoakTest.cpp                                   :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/19 20:07:33 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/19 20:07:33 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file SoakTest.cpp
+ * @brief Implementation of the navigation soak test.
+ */
+
+#include "SoakTest.hpp"
+#include "PageManager.hpp"
+#include "PageRegistry.hpp"
+#include "Notifications.hpp"
+#include "../../screen/LVGLArena.hpp"
+#include <Arduino.h>
+#include <lvgl.h>
+
+PageManager* SoakTest::pages = nullptr;
+bool SoakTest::active = false;
+uint32_t SoakTest::seed = 0;
+uint32_t SoakTest::rng = 0;
+uint32_t SoakTest::target = 0;
+uint32_t SoakTest::transitions = 0;
+uint32_t SoakTest::taps = 0;
+uint32_t SoakTest::startMs = 0;
+uint32_t SoakTest::lastStep = 0;
+SoakTest::Window SoakTest::history[HISTORY] = {};
+uint32_t SoakTest::windows = 0;
+SoakTest::Window SoakTest::current = {};
+bool SoakTest::leakFlag = false;
+bool SoakTest::fragFlag = false;
+SoakTest::PageTrack SoakTest::tracks[PAGE_COUNT] = {};
+
+namespace {
+
+// Taps here would overwrite the stored touch calibration
+constexpr PageID NO_TAP_PAGES[] = { PAGE_TOUCH_CALIBRATION };
+
+uint32_t countClickable(lv_obj_t* obj) {
+    uint32_t n = lv_obj_has_flag(obj, LV_OBJ_FLAG_CLICKABLE) ? 1 : 0;
+    for (uint32_t i = 0; i < lv_obj_get_child_cnt(obj); i++) n += countClickable(lv_obj_get_child(obj, i));
+    return n;
+}
+
+// Depth-first, index-th clickable object under obj
+lv_obj_t* findClickable(lv_obj_t* obj, uint32_t& index) {
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_CLICKABLE) && index-- == 0) return obj;
+    for (uint32_t i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        lv_obj_t* found = findClickable(lv_obj_get_child(obj, i), index);
+        if (found) return found;
+    }
+    return nullptr;
+}
+
+} // namespace
+
+/**
+ * @brief xorshift32: reproducible from the seed, independent of random().
+ */
+uint32_t SoakTest::next() {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+void SoakTest::start(PageManager* mgr, uint32_t count, uint32_t seedValue) {
+    if (!mgr) return;
+    pages = mgr;
+    seed = seedValue ? seedValue : (esp_random() | 1);
+    rng = seed;
+    target = count;
+    transitions = 0;
+    taps = 0;
+    windows = 0;
+    current = Window{UINT32_MAX, UINT32_MAX};
+    leakFlag = false;
+    fragFlag = false;
+    for (auto& track : tracks) track = PageTrack{};
+    startMs = lastStep = millis();
+    active = true;
+    Serial.printf("[SoakTest] Started: %lu transitions, seed %lu\n", (unsigned long)target, (unsigned long)seed);
+}
+
+void SoakTest::stop() {
+    if (!active) return;
+    active = false;
+    Serial.printf("[SoakTest] Stopped after %lu transitions\n", (unsigned long)transitions);
+    printReport(Serial);
+}
+
+/**
+ * @brief Sends a click to a random clickable object of the open dialog,
+ * or of the current page.
+ */
+void SoakTest::tap() {
+    lv_obj_t* root = Notifications::isDialogOpen() ? lv_layer_top() : lv_scr_act();
+    if (!root) return;
+    uint32_t count = countClickable(root);
+    if (!count) return;
+    uint32_t index = next() % count;
+    lv_obj_t* obj = findClickable(root, index);
+    if (!obj) return;
+    lv_event_send(obj, LV_EVENT_CLICKED, nullptr);
+    taps++;
+}
+
+void SoakTest::loop() {
+    if (!active || millis() - lastStep < SOAK_STEP_MS) return;
+    lastStep = millis();
+
+    PageID page = pages->getCurrentPageId();
+    bool canTap = true;
+    for (PageID id : NO_TAP_PAGES) canTap &= id != page;
+    if (canTap || Notifications::isDialogOpen()) {
+        for (uint32_t n = next() % 3; n > 0; n--) tap();
+    }
+
+    PageID destination;
+    do {
+        destination = static_cast<PageID>(next() % PAGE_COUNT);
+    } while (!PageRegistry::exists(destination));
+    pages->navigateToPage(destination);
+    transitions++;
+    sample(pages->getCurrentPageId());
+
+    if (transitions % SOAK_WINDOW == 0) closeWindow();
+    if (transitions >= target) stop();
+}
+
+/**
+ * @brief Heap sample after a transition, plus the arena of the page shown.
+ */
+void SoakTest::sample(PageID page) {
+    lv_mem_monitor_t mon;
+    LVGLArena::monitor(&mon);
+    uint32_t used = mon.total_size - mon.free_size;
+    if (used < current.usedFloor) current.usedFloor = used;
+    if (mon.free_biggest_size < current.biggestFloor) current.biggestFloor = mon.free_biggest_size;
+
+    PageTrack& track = tracks[page];
+    uint32_t arena = LVGLArena::pageUsed(static_cast<uint8_t>(page));
+    track.streak = track.visits && arena > track.lastUsed ? track.streak + 1 : 0;
+    if (track.streak >= PAGE_STREAK && !track.flagged) {
+        track.flagged = true;
+        Serial.printf("[SoakTest] WARNING: page %d grew on %u visits in a row (%lu bytes)\n",
+                      (int)page, (unsigned)track.streak, (unsigned long)arena);
+    }
+    track.lastUsed = arena;
+    if (arena > track.maxUsed) track.maxUsed = arena;
+    track.visits++;
+}
+
+void SoakTest::closeWindow() {
+    history[windows % HISTORY] = current;
+    windows++;
+    current = Window{UINT32_MAX, UINT32_MAX};
+
+    Serial.printf("[SoakTest] %lu/%lu  floor used %lu  biggest free %lu  slope %ld B/window\n",
+                  (unsigned long)transitions, (unsigned long)target,
+                  (unsigned long)history[(windows - 1) % HISTORY].usedFloor,
+                  (unsigned long)history[(windows - 1) % HISTORY].biggestFloor, (long)usedSlope());
+
+    if (windows < WARMUP_WINDOWS + SOAK_GROWTH_WINDOWS) return;
+    bool growing = true;
+    bool shrinking = true;
+    for (uint32_t w = windows - SOAK_GROWTH_WINDOWS + 1; w < windows; w++) {
+        const Window& prev = history[(w - 1) % HISTORY];
+        const Window& cur = history[w % HISTORY];
+        growing &= cur.usedFloor > prev.usedFloor;
+        shrinking &= cur.biggestFloor < prev.biggestFloor;
+    }
+    if (growing && !leakFlag) {
+        leakFlag = true;
+        Serial.printf("[SoakTest] WARNING: used floor grew for %u windows in a row (leak?)\n",
+                      (unsigned)SOAK_GROWTH_WINDOWS);
+    }
+    if (shrinking && !fragFlag) {
+        fragFlag = true;
+        Serial.printf("[SoakTest] WARNING: biggest free block shrank for %u windows in a row (fragmentation?)\n",
+                      (unsigned)SOAK_GROWTH_WINDOWS);
+    }
+}
+
+/**
+ * @brief Least-squares slope of the used floor over the kept windows,
+ * warm-up windows excluded.
+ */
+int32_t SoakTest::usedSlope() {
+    uint32_t first = windows > HISTORY ? windows - HISTORY : 0;
+    if (first < WARMUP_WINDOWS) first = WARMUP_WINDOWS;
+    if (windows < first + 2) return 0;
+
+    int64_t n = windows - first;
+    int64_t sumX = 0, sumY = 0, sumXY = 0, sumXX = 0;
+    for (uint32_t w = first; w < windows; w++) {
+        int64_t x = w - first;
+        int64_t y = history[w % HISTORY].usedFloor;
+        sumX += x;
+        sumY += y;
+        sumXY += x * y;
+        sumXX += x * x;
+    }
+    int64_t den = n * sumXX - sumX * sumX;
+    return den ? (int32_t)((n * sumXY - sumX * sumY) / den) : 0;
+}
+
+void SoakTest::printReport(Print& out) {
+    uint32_t elapsed = (millis() - startMs) / 1000;
+    out.printf("=== Soak test (seed %lu) ===\n", (unsigned long)seed);
+    out.printf("%s  %lu/%lu transitions, %lu taps, %lu s\n", active ? "running" : "stopped",
+               (unsigned long)transitions, (unsigned long)target, (unsigned long)taps, (unsigned long)elapsed);
+    out.printf("used floor slope %ld bytes/window  leak %s  fragmentation %s\n", (long)usedSlope(),
+               leakFlag ? "SUSPECTED" : "no", fragFlag ? "SUSPECTED" : "no");
+
+    uint32_t first = windows > HISTORY ? windows - HISTORY : 0;
+    for (uint32_t w = first; w < windows; w++) {
+        out.printf("  window %4lu  used floor %7lu  biggest free %7lu\n", (unsigned long)w,
+                   (unsigned long)history[w % HISTORY].usedFloor,
+                   (unsigned long)history[w % HISTORY].biggestFloor);
+    }
+    for (uint8_t i = 0; i < PAGE_COUNT; i++) {
+        const PageTrack& track = tracks[i];
+        if (!track.visits) continue;
+        out.printf("  page %2u  %6lu visits  arena last %6lu  max %6lu%s\n", (unsigned)i,
+                   (unsigned long)track.visits, (unsigned long)track.lastUsed,
+                   (unsigned long)track.maxUsed, track.flagged ? "  GROWING" : "");
+    }
+}
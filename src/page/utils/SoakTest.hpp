@@ -0,0 +1,118 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   SoakTest.hpp                                   :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/19 20:07:33 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/19 20:07:33 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file SoakTest.hpp
+ * @brief Long-run random navigation that watches the LVGL heap.
+ *
+ * Mode endurance : à chaque pas, quelques appuis simulés sur la page (ou
+ * sur le dialogue ouvert), puis navigation vers une page tirée au hasard
+ * via PageManager::navigateToPage. Le tas LVGL (LVGLArena) est échantillonné
+ * à chaque transition ; par fenêtre de SOAK_WINDOW transitions on garde le
+ * plancher (minimum) d'occupation et le plancher du plus grand bloc libre.
+ * Une fuite fait monter le plancher à chaque fenêtre, la fragmentation fait
+ * baisser le plus grand bloc : SOAK_GROWTH_WINDOWS fenêtres monotones de
+ * suite lèvent une alerte. Par page, l'occupation de son arène est comparée
+ * d'une visite à l'autre (une page qui grossit tant qu'elle reste en cache
+ * recrée des objets à chaque visite).
+ */
+
+#ifndef SOAK_TEST_HPP
+#define SOAK_TEST_HPP
+
+#include <stdint.h>
+#include "Page.hpp"
+
+/** @brief Nombre de transitions par défaut */
+#ifndef SOAK_DEFAULT_TRANSITIONS
+#define SOAK_DEFAULT_TRANSITIONS 100000UL
+#endif
+
+/** @brief Intervalle minimum entre deux transitions (laisse LVGL dessiner) */
+#ifndef SOAK_STEP_MS
+#define SOAK_STEP_MS 20
+#endif
+
+/** @brief Transitions par fenêtre d'échantillonnage */
+#ifndef SOAK_WINDOW
+#define SOAK_WINDOW 500
+#endif
+
+/** @brief Fenêtres monotones consécutives avant alerte */
+#ifndef SOAK_GROWTH_WINDOWS
+#define SOAK_GROWTH_WINDOWS 6
+#endif
+
+class PageManager;
+class Print;
+
+class SoakTest {
+public:
+    static constexpr uint8_t HISTORY = 64;
+    static constexpr uint8_t WARMUP_WINDOWS = 2;     // cache encore en remplissage
+    static constexpr uint8_t PAGE_STREAK = 8;        // visites en hausse avant alerte
+
+    /**
+     * @brief Démarre l'endurance
+     * @param pages Gestionnaire de pages
+     * @param transitions Nombre de transitions
+     * @param seed Graine du tirage (0 : tirée au hasard, affichée pour rejouer)
+     */
+    static void start(PageManager* pages, uint32_t transitions = SOAK_DEFAULT_TRANSITIONS, uint32_t seed = 0);
+    static void stop();
+    static bool running() { return active; }
+
+    /**
+     * @brief Fait un pas si SOAK_STEP_MS est écoulé (à appeler dans loop())
+     */
+    static void loop();
+
+    static void printReport(Print& out);
+
+private:
+    struct Window {
+        uint32_t usedFloor;
+        uint32_t biggestFloor;
+    };
+
+    struct PageTrack {
+        uint32_t visits;
+        uint32_t lastUsed;
+        uint32_t maxUsed;
+        uint8_t streak;
+        bool flagged;
+    };
+
+    static PageManager* pages;
+    static bool active;
+    static uint32_t seed;
+    static uint32_t rng;
+    static uint32_t target;
+    static uint32_t transitions;
+    static uint32_t taps;
+    static uint32_t startMs;
+    static uint32_t lastStep;
+
+    static Window history[HISTORY];
+    static uint32_t windows;
+    static Window current;
+    static bool leakFlag;
+    static bool fragFlag;
+    static PageTrack tracks[PAGE_COUNT];
+
+    static uint32_t next();
+    static void tap();
+    static void sample(PageID page);
+    static void closeWindow();
+    static int32_t usedSlope();
+};
+
+#endif // SOAK_TEST_HPP
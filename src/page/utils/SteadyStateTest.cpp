@@ -0,0 +1,132 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   SteadyStateTest.cpp                            :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/19 18:20:52 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/19 18:20:52 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file SteadyStateTest.cpp
+ * @brief Steady-state allocation scenarios.
+ */
+
+#include "SteadyStateTest.hpp"
+#include "PageManager.hpp"
+#include "UiStore.hpp"
+#include "../../screen/AllocWatch.hpp"
+#include "../../screen/DisplayLVGL.hpp"
+#include <Arduino.h>
+#include <lvgl.h>
+
+namespace {
+
+constexpr uint16_t WARMUP_FRAMES = 30;
+constexpr uint16_t MEASURE_FRAMES = 200;
+constexpr uint8_t FRAME_MS = 5;
+
+// Widget driven by the current scenario (found during warm-up)
+lv_obj_t* slider = nullptr;
+
+lv_obj_t* findSlider(lv_obj_t* obj) {
+    if (lv_obj_check_type(obj, &lv_slider_class)) return obj;
+    for (uint32_t i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        lv_obj_t* found = findSlider(lv_obj_get_child(obj, i));
+        if (found) return found;
+    }
+    return nullptr;
+}
+
+// Live values change every frame, like the sensor loop but faster
+void stepValues(uint16_t frame) {
+    UiStore::set(UiKey::PH, 7.0f + (frame % 10) / 10.0f);
+    UiStore::set(UiKey::REDOX, 700 + (frame % 100));
+    UiStore::set(UiKey::TEMPERATURE, 24.0f + (frame % 20) / 10.0f);
+}
+
+// Nothing changes: timers, touch polling, UI store frame
+void stepIdle(uint16_t frame) {
+}
+
+// Full-screen redraw: draw buffers, masks, display_flush
+void stepRedraw(uint16_t frame) {
+    lv_obj_invalidate(lv_scr_act());
+}
+
+// Back-and-forth drag, as LVGL reports it to the page
+void stepSlider(uint16_t frame) {
+    if (!slider) slider = findSlider(lv_scr_act());
+    if (!slider) return;
+    int32_t min = lv_slider_get_min_value(slider);
+    int32_t span = lv_slider_get_max_value(slider) - min;
+    int32_t pos = span ? frame % (2 * span) : 0;
+    lv_slider_set_value(slider, min + (pos < span ? pos : 2 * span - pos), LV_ANIM_OFF);
+    lv_event_send(slider, LV_EVENT_VALUE_CHANGED, nullptr);
+}
+
+struct Scenario {
+    const char* name;
+    PageID page;
+    void (*step)(uint16_t frame);
+};
+
+constexpr Scenario scenarios[] = {
+    { "live values",  PAGE_MAIN_DISPLAY, stepValues },
+    { "idle frames",  PAGE_MAIN_DISPLAY, stepIdle },
+    { "full redraw",  PAGE_SETTINGS,     stepRedraw },
+    { "slider drag",  PAGE_SCREEN,       stepSlider },
+};
+
+} // namespace
+
+/**
+ * @brief Runs every scenario: warm-up frames unwatched, then measured
+ * frames with AllocWatch armed on the calling task. That is the loop task:
+ * it holds the UI lock and drives the frames itself, so the UI task stays
+ * parked meanwhile.
+ */
+bool runSteadyStateTest(PageManager& pages, DisplayLVGL& display, Print& out) {
+    PageID start = pages.getCurrentPageId();
+    uint8_t failed = 0;
+
+    out.printf("=== Steady-state allocation test ===\n");
+#if !ALLOC_WATCH_WRAP
+    out.printf("malloc/heap_caps not hooked in this build (use the allocwatch env): LVGL allocations only\n");
+#endif
+    for (const Scenario& scenario : scenarios) {
+        slider = nullptr;
+        pages.navigateToPage(scenario.page);
+
+        uint16_t frame = 0;
+        for (; frame < WARMUP_FRAMES; frame++) {
+            scenario.step(frame);
+            display.loop();
+            delay(FRAME_MS);
+        }
+
+        AllocWatch::arm();
+        for (uint16_t end = frame + MEASURE_FRAMES; frame < end; frame++) {
+            scenario.step(frame);
+            display.loop();
+            delay(FRAME_MS);
+        }
+        uint32_t allocations = AllocWatch::disarm();
+
+        out.printf("%-12s %s  %lu allocations in %u frames\n", scenario.name,
+                   allocations ? "FAIL" : "PASS", (unsigned long)allocations, (unsigned)MEASURE_FRAMES);
+        if (allocations) {
+            failed++;
+            AllocWatch::printSites(out);
+        }
+    }
+
+    slider = nullptr;
+    pages.navigateToPage(start);
+    out.printf("%u/%u scenarios allocation-free\n",
+               (unsigned)(sizeof(scenarios) / sizeof(scenarios[0]) - failed),
+               (unsigned)(sizeof(scenarios) / sizeof(scenarios[0])));
+    return failed == 0;
+}
@@ -0,0 +1,40 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   SteadyStateTest.hpp                            :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/19 18:20:52 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/19 18:20:52 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file SteadyStateTest.hpp
+ * @brief Self-test: no heap allocation once the UI is warmed up.
+ *
+ * Chaque scénario ouvre sa page, tourne quelques trames de chauffe, puis
+ * compte les allocations (AllocWatch) pendant des trames en régime établi.
+ * Une seule allocation fait échouer le scénario ; les piles d'appel sont
+ * affichées pour addr2line.
+ */
+
+#ifndef STEADY_STATE_TEST_HPP
+#define STEADY_STATE_TEST_HPP
+
+#include <stdint.h>
+
+class DisplayLVGL;
+class PageManager;
+class Print;
+
+/**
+ * @brief Lance tous les scénarios puis revient à la page de départ
+ * @param pages Gestionnaire de pages
+ * @param display Écran (une trame = display.loop())
+ * @param out Sortie du rapport
+ * @return true si aucun scénario n'a alloué
+ */
+bool runSteadyStateTest(PageManager& pages, DisplayLVGL& display, Print& out);
+
+#endif // STEADY_STATE_TEST_HPP
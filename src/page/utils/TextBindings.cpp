@@ -0,0 +1,131 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   TextBindings.cpp                               :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/19 00:02:48 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/19 00:02:48 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file TextBindings.cpp
+ * @brief Translated label registry: language hot-switch without rebuilding pages.
+ */
+
+#include "TextBindings.hpp"
+#include <Arduino.h>
+
+Text* TextBindings::translator = nullptr;
+TextBindings::Binding TextBindings::bindings[MAX_BINDINGS] = {};
+uint8_t TextBindings::count = 0;
+uint8_t TextBindings::peak = 0;
+uint32_t TextBindings::switches = 0;
+uint32_t TextBindings::lastSwitchUs = 0;
+uint16_t TextBindings::lastSwitchLabels = 0;
+
+void TextBindings::begin(Text* translator) {
+    TextBindings::translator = translator;
+}
+
+Text::Language TextBindings::language() {
+    return translator ? translator->getCurrentLanguage() : Text::Language::FRENCH;
+}
+
+TextBindings::Binding* TextBindings::add(const void* owner) {
+    if (count >= MAX_BINDINGS) {
+        Serial.printf("[TextBindings] ERROR: table full (%u), text will not follow the language\n",
+                      (unsigned)MAX_BINDINGS);
+        return nullptr;
+    }
+    Binding& b = bindings[count++];
+    b = Binding{};
+    b.owner = owner;
+    if (count > peak) peak = count;
+    return &b;
+}
+
+/**
+ * @brief Binds a label to a translated string and shows it in the current language.
+ * @param owner Page owning the label.
+ * @param label Label (or button label).
+ * @param id String identifier.
+ * @return False if the table is full; the label still gets the current text.
+ */
+bool TextBindings::bind(const void* owner, lv_obj_t* label, StrId id) {
+    if (!label) return false;
+    lv_label_set_text_static(label, Text::get(id, language()));
+
+    Binding* b = add(owner);
+    if (!b) return false;
+    b->label = label;
+    b->id = id;
+    return true;
+}
+
+/**
+ * @brief Registers a language change callback.
+ * @param owner Page owning the widgets touched by the callback.
+ * @param cb Callback.
+ * @param ctx User context for the callback.
+ * @return False if the table is full.
+ */
+bool TextBindings::observe(const void* owner, LanguageObserver cb, void* ctx) {
+    if (!cb) return false;
+    Binding* b = add(owner);
+    if (!b) return false;
+    b->observer = cb;
+    b->ctx = ctx;
+    return true;
+}
+
+/**
+ * @brief Removes every binding of a page.
+ * @param owner Page.
+ */
+void TextBindings::unbind(const void* owner) {
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (bindings[i].owner != owner) bindings[kept++] = bindings[i];
+    }
+    count = kept;
+}
+
+/**
+ * @brief Switches the language and re-texts every bound label in place.
+ * Pages that are not built have no bindings: they are built in the new language.
+ * @param lang New language.
+ * @return Time spent updating the labels, in microseconds.
+ */
+uint32_t TextBindings::setLanguage(Text::Language lang) {
+    if (translator) translator->setLanguage(lang);
+
+    uint32_t start = micros();
+    uint16_t labels = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        Binding& b = bindings[i];
+        if (b.label) {
+            lv_label_set_text_static(b.label, Text::get(b.id, lang));
+            labels++;
+        } else if (b.observer) {
+            b.observer(b.ctx, lang);
+        }
+    }
+    lastSwitchUs = micros() - start;
+    lastSwitchLabels = labels;
+    switches++;
+
+    Serial.printf("[TextBindings] Language %u: %u labels, %u observers re-texted in %lu us\n",
+                  (unsigned)lang, (unsigned)labels, (unsigned)(count - labels),
+                  (unsigned long)lastSwitchUs);
+    return lastSwitchUs;
+}
+
+void TextBindings::printReport(Print& out) {
+    out.printf("=== Text bindings ===\n");
+    out.printf("bindings %u/%u (peak %u)  switches %lu\n",
+               (unsigned)count, (unsigned)MAX_BINDINGS, (unsigned)peak, (unsigned long)switches);
+    out.printf("last switch: %u labels in %lu us\n",
+               (unsigned)lastSwitchLabels, (unsigned long)lastSwitchUs);
+}
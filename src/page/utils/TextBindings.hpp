@@ -0,0 +1,91 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   TextBindings.hpp                               :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/19 00:02:48 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/19 00:02:48 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file TextBindings.hpp
+ * @brief Registry of translated labels, re-texted in place on a language change.
+ */
+
+#ifndef TEXT_BINDINGS_HPP
+#define TEXT_BINDINGS_HPP
+
+#include <lvgl.h>
+#include <stdint.h>
+#include "../../Translation/text.hpp"
+
+class Print;
+
+/**
+ * @brief Appelé au changement de langue (widgets composés : menus, listes...)
+ */
+typedef void (*LanguageObserver)(void* ctx, Text::Language lang);
+
+/**
+ * @class TextBindings
+ * @brief Liaisons label -> identifiant de chaîne traduite.
+ *
+ * Les pages lient leurs labels traduits au lieu d'y copier un texte : au
+ * changement de langue, seuls ces labels sont mis à jour (pointeur vers le
+ * pool en flash), sur la page visible comme sur les pages gardées en cache,
+ * sans reconstruire aucun écran. owner est la page (unbind dans destroy()).
+ */
+class TextBindings {
+public:
+    static constexpr uint8_t MAX_BINDINGS = 128;
+
+    static void begin(Text* translator);
+
+    /**
+     * @brief Lie un label à une chaîne ; le texte est appliqué immédiatement
+     * @return false si la table est pleine (le label garde le texte actuel)
+     */
+    static bool bind(const void* owner, lv_obj_t* label, StrId id);
+
+    /**
+     * @brief Appelle cb à chaque changement de langue
+     */
+    static bool observe(const void* owner, LanguageObserver cb, void* ctx);
+
+    /**
+     * @brief Supprime les liaisons d'une page (avant de détruire ses widgets)
+     */
+    static void unbind(const void* owner);
+
+    /**
+     * @brief Change la langue et met à jour tous les labels liés
+     * @return durée de la mise à jour en microsecondes
+     */
+    static uint32_t setLanguage(Text::Language lang);
+
+    static Text::Language language();
+    static void printReport(Print& out);
+
+private:
+    struct Binding {
+        const void* owner;
+        lv_obj_t* label;
+        StrId id;
+        LanguageObserver observer;
+        void* ctx;
+    };
+
+    static Text* translator;
+    static Binding bindings[MAX_BINDINGS];
+    static uint8_t count;
+    static uint8_t peak;
+    static uint32_t switches;
+    static uint32_t lastSwitchUs;
+    static uint16_t lastSwitchLabels;
+
+    static Binding* add(const void* owner);
+};
+
+#endif
@@ -0,0 +1,289 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   UiQueue.cpp                                    :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/20 11:38:02 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/20 11:38:02 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file UiQueue.cpp
+ * @brief Implementation of the UI message queue.
+ */
+
+#include "UiQueue.hpp"
+#include "PageManager.hpp"
+#include "Notifications.hpp"
+#include "TextBindings.hpp"
+#include <Arduino.h>
+#include <cstring>
+
+static_assert((UiQueue::CAPACITY & (UiQueue::CAPACITY - 1)) == 0, "capacity must be a power of two");
+static_assert(static_cast<uint8_t>(UiKey::COUNT) + 2 <= 32, "stranded holds one bit per coalescing slot");
+
+UiQueue::Cell UiQueue::cells[CAPACITY];
+std::atomic<uint32_t> UiQueue::enqueuePos(0);
+uint32_t UiQueue::dequeuePos = 0;
+std::atomic<uint32_t> UiQueue::pending[SLOT_COUNT];
+std::atomic<uint32_t> UiQueue::latest[SLOT_COUNT];
+std::atomic<uint32_t> UiQueue::stranded(0);
+std::atomic<uint32_t> UiQueue::strandedPosts(0);
+UiQueue::TypeStats UiQueue::stats[static_cast<uint8_t>(UiMsgType::COUNT)];
+PageManager* UiQueue::pages = nullptr;
+bool UiQueue::ready = false;
+uint8_t UiQueue::depthPeak = 0;
+uint32_t UiQueue::budgetStops = 0;
+
+namespace {
+
+constexpr uint32_t MASK = UiQueue::CAPACITY - 1;
+
+constexpr UiMsgPolicy POLICY[] = {
+    UiMsgPolicy::COALESCE,  // VALUE: only the latest reading matters
+    UiMsgPolicy::DROP,      // TOAST: every message is distinct
+    UiMsgPolicy::COALESCE,  // NAVIGATE: go to the last requested page
+    UiMsgPolicy::COALESCE,  // LANGUAGE
+};
+
+constexpr const char* TYPE_NAMES[] = { "value", "toast", "navigate", "language" };
+
+static_assert(sizeof(POLICY) / sizeof(POLICY[0]) == static_cast<uint8_t>(UiMsgType::COUNT),
+              "one policy per message type");
+
+uint32_t floatBits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float bitsFloat(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+} // namespace
+
+void UiQueue::begin(PageManager* mgr) {
+    pages = mgr;
+    for (uint32_t i = 0; i < CAPACITY; i++) cells[i].sequence.store(i, std::memory_order_relaxed);
+    enqueuePos.store(0, std::memory_order_relaxed);
+    dequeuePos = 0;
+    for (auto& slot : pending) slot.store(0, std::memory_order_relaxed);
+    stranded.store(0, std::memory_order_relaxed);
+    ready = true;
+}
+
+/**
+ * @brief Vyukov bounded enqueue: claim a position with a CAS, fill the
+ * cell, then publish it through its sequence number.
+ */
+bool UiQueue::enqueue(const UiMessage& msg) {
+    uint32_t pos = enqueuePos.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &cells[pos & MASK];
+        uint32_t seq = cell->sequence.load(std::memory_order_acquire);
+        int32_t diff = (int32_t)(seq - pos);
+        if (diff == 0) {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return false;   // full: the consumer has not freed this cell yet
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    cell->msg = msg;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Single consumer: no CAS, the cell is handed back CAPACITY
+ * positions ahead.
+ */
+bool UiQueue::dequeue(UiMessage& msg) {
+    Cell& cell = cells[dequeuePos & MASK];
+    uint32_t seq = cell.sequence.load(std::memory_order_acquire);
+    if ((int32_t)(seq - (dequeuePos + 1)) < 0) return false;
+    msg = cell.msg;
+    cell.sequence.store(dequeuePos + CAPACITY, std::memory_order_release);
+    dequeuePos++;
+    return true;
+}
+
+uint8_t UiQueue::slotOf(UiMsgType type, uint8_t key) {
+    switch (type) {
+        case UiMsgType::VALUE: return SLOT_VALUE + key;
+        case UiMsgType::NAVIGATE: return SLOT_NAVIGATE;
+        case UiMsgType::LANGUAGE: return SLOT_LANGUAGE;
+        default: return SLOT_COUNT;
+    }
+}
+
+/**
+ * @brief Posts a message with the policy of its type.
+ *
+ * COALESCE stores the latest data of the slot and enqueues a message only
+ * if none is pending for it. The consumer clears the flag with an exchange
+ * before reading the data: a producer that still saw the flag set is
+ * ordered before that exchange, so its data is read; a later one gets its
+ * own message. If that message does not fit, the flag stays set and the
+ * slot is marked stranded: the next drain applies it without a message,
+ * so the post (and any coalesced into it) is still accepted.
+ */
+bool UiQueue::post(UiMsgType type, uint8_t key, uint32_t data, const char* text) {
+    TypeStats& s = stats[static_cast<uint8_t>(type)];
+    s.posted.fetch_add(1, std::memory_order_relaxed);
+
+    uint8_t slot = slotOf(type, key);
+    bool coalesce = POLICY[static_cast<uint8_t>(type)] == UiMsgPolicy::COALESCE && slot < SLOT_COUNT;
+    if (coalesce) {
+        latest[slot].store(data, std::memory_order_release);
+        if (pending[slot].exchange(1, std::memory_order_acq_rel)) {
+            s.coalesced.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    UiMessage msg;
+    msg.type = type;
+    msg.key = key;
+    msg.data = data;
+    msg.postedUs = micros();
+    if (text) {
+        strncpy(msg.text, text, sizeof(msg.text) - 1);
+        msg.text[sizeof(msg.text) - 1] = '\0';
+    } else {
+        msg.text[0] = '\0';
+    }
+    if (enqueue(msg)) return true;
+
+    if (coalesce) {
+        strandedPosts.fetch_add(1, std::memory_order_relaxed);
+        stranded.fetch_or(1u << slot, std::memory_order_release);
+        return true;
+    }
+    s.dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+bool UiQueue::postValue(UiKey key, float value) {
+    if (!ready || key >= UiKey::COUNT) return false;
+    return post(UiMsgType::VALUE, static_cast<uint8_t>(key), floatBits(value), nullptr);
+}
+
+bool UiQueue::postToast(const char* text) {
+    if (!ready || !text) return false;
+    return post(UiMsgType::TOAST, 0, 0, text);
+}
+
+bool UiQueue::postNavigate(PageID page) {
+    if (!ready || page >= PAGE_COUNT) return false;
+    return post(UiMsgType::NAVIGATE, 0, static_cast<uint32_t>(page), nullptr);
+}
+
+bool UiQueue::postLanguage(Text::Language lang) {
+    if (!ready || lang >= Text::Language::LANGUAGE_COUNT) return false;
+    return post(UiMsgType::LANGUAGE, 0, static_cast<uint32_t>(lang), nullptr);
+}
+
+/**
+ * @brief Applies one message in the UI task. Coalesced types take the
+ * latest data of their slot.
+ */
+void UiQueue::apply(const UiMessage& msg) {
+    uint32_t data = msg.data;
+    uint8_t slot = slotOf(msg.type, msg.key);
+    if (POLICY[static_cast<uint8_t>(msg.type)] == UiMsgPolicy::COALESCE && slot < SLOT_COUNT) {
+        // exchange (not store): a store could pass the load below and miss
+        // data from a producer that saw the flag still set
+        pending[slot].exchange(0, std::memory_order_acq_rel);
+        data = latest[slot].load(std::memory_order_acquire);
+    }
+
+    switch (msg.type) {
+        case UiMsgType::VALUE:
+            UiStore::set(static_cast<UiKey>(msg.key), bitsFloat(data));
+            break;
+        case UiMsgType::TOAST:
+            Notifications::toast(msg.text);
+            break;
+        case UiMsgType::NAVIGATE:
+            if (pages) pages->navigateToPage(static_cast<PageID>(data));
+            break;
+        case UiMsgType::LANGUAGE:
+            TextBindings::setLanguage(static_cast<Text::Language>(data));
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Applies the slots whose message did not fit in the queue. Such a
+ * slot has no message queued (only the producer that set its pending flag
+ * enqueues), so it is applied exactly once here.
+ */
+void UiQueue::applyStranded() {
+    uint32_t mask = stranded.exchange(0, std::memory_order_acq_rel);
+    for (uint8_t slot = 0; mask; slot++, mask >>= 1) {
+        if (!(mask & 1)) continue;
+        UiMessage msg;
+        msg.type = slot < SLOT_NAVIGATE ? UiMsgType::VALUE
+                 : slot == SLOT_NAVIGATE ? UiMsgType::NAVIGATE : UiMsgType::LANGUAGE;
+        msg.key = slot < SLOT_NAVIGATE ? slot - SLOT_VALUE : 0;
+        msg.data = 0;
+        msg.text[0] = '\0';
+        apply(msg);
+    }
+}
+
+uint16_t UiQueue::drain(uint32_t budgetUs) {
+    if (!ready) return 0;
+    uint32_t start = micros();
+    applyStranded();
+    uint32_t depth = enqueuePos.load(std::memory_order_relaxed) - dequeuePos;
+    if (depth > CAPACITY) depth = CAPACITY;     // positions claimed, cells not yet filled
+    if (depth > depthPeak) depthPeak = (uint8_t)depth;
+
+    uint16_t applied = 0;
+    UiMessage msg;
+    while (dequeue(msg)) {
+        apply(msg);
+        applied++;
+
+        uint32_t now = micros();
+        TypeStats& s = stats[static_cast<uint8_t>(msg.type)];
+        uint32_t latency = now - msg.postedUs;
+        s.applied++;
+        s.latencySumUs += latency;
+        if (latency > s.latencyMaxUs) s.latencyMaxUs = latency;
+
+        if (now - start >= budgetUs) {
+            budgetStops++;
+            break;
+        }
+    }
+    return applied;
+}
+
+void UiQueue::printReport(Print& out) {
+    out.printf("=== UI queue ===\n");
+    out.printf("depth %lu/%u  peak %u  budget %u us  budget stops %lu  stranded (queue full, applied later) %lu\n",
+               (unsigned long)(enqueuePos.load(std::memory_order_relaxed) - dequeuePos), (unsigned)CAPACITY,
+               (unsigned)depthPeak, (unsigned)UI_QUEUE_BUDGET_US, (unsigned long)budgetStops,
+               (unsigned long)strandedPosts.load());
+    for (uint8_t i = 0; i < static_cast<uint8_t>(UiMsgType::COUNT); i++) {
+        const TypeStats& s = stats[i];
+        out.printf("  %-8s %-8s posted %6lu  coalesced %6lu  dropped %4lu  applied %6lu  latency avg %5lu max %6lu us\n",
+                   TYPE_NAMES[i], POLICY[i] == UiMsgPolicy::COALESCE ? "coalesce" : "drop",
+                   (unsigned long)s.posted.load(), (unsigned long)s.coalesced.load(),
+                   (unsigned long)s.dropped.load(), (unsigned long)s.applied,
+                   (unsigned long)(s.applied ? s.latencySumUs / s.applied : 0),
+                   (unsigned long)s.latencyMaxUs);
+    }
+}
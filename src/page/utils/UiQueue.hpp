@@ -0,0 +1,143 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   UiQueue.hpp                                    :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/20 11:38:02 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/20 11:38:02 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file UiQueue.hpp
+ * @brief Lock-free queue of UI messages from any task to the UI task.
+ *
+ * File bornée multi-producteurs / consommateur unique (Vyukov) de messages
+ * de taille fixe. Les producteurs (capteurs, réseau, liaison contrôleur,
+ * ISR) ne prennent aucun verrou ; la tâche UI vide la file une fois par
+ * cycle LVGL, dans un budget de temps, puis applique chaque message
+ * (UiStore, Notifications, PageManager, TextBindings).
+ *
+ * Politique par type :
+ *   COALESCE  un seul message en attente par clé ; les envois suivants
+ *             remplacent la valeur (la dernière gagne). File pleine : la
+ *             clé reste en attente et la prochaine vidange l'applique
+ *             sans message (jamais perdue)
+ *   DROP      file pleine : le nouveau message est rejeté (compté)
+ */
+
+#ifndef UI_QUEUE_HPP
+#define UI_QUEUE_HPP
+
+#include <atomic>
+#include <stdint.h>
+#include "Page.hpp"
+#include "UiStore.hpp"
+#include "../../Translation/text.hpp"
+
+/** @brief Temps maximum passé à vider la file par cycle */
+#ifndef UI_QUEUE_BUDGET_US
+#define UI_QUEUE_BUDGET_US 1000
+#endif
+
+class PageManager;
+class Print;
+
+enum class UiMsgType : uint8_t {
+    VALUE,      // UiKey + valeur -> UiStore
+    TOAST,      // texte -> Notifications
+    NAVIGATE,   // PageID -> PageManager
+    LANGUAGE,   // langue -> TextBindings
+    COUNT
+};
+
+enum class UiMsgPolicy : uint8_t {
+    COALESCE,
+    DROP
+};
+
+/**
+ * @brief Message de taille fixe (copié dans la file)
+ */
+struct UiMessage {
+    static constexpr uint8_t TEXT_LEN = 40;
+
+    UiMsgType type;
+    uint8_t key;        // UiKey pour VALUE
+    uint32_t data;      // valeur (bits du float), PageID ou langue
+    uint32_t postedUs;
+    char text[TEXT_LEN];
+};
+
+class UiQueue {
+public:
+    static constexpr uint8_t CAPACITY = 32;     // puissance de 2
+
+    /**
+     * @brief Prépare la file (avant le premier producteur)
+     */
+    static void begin(PageManager* pages);
+
+    /**
+     * @brief Envois, utilisables depuis n'importe quelle tâche ou ISR
+     * @return false si le message a été rejeté (file pleine)
+     */
+    static bool postValue(UiKey key, float value);
+    static bool postToast(const char* text);
+    static bool postNavigate(PageID page);
+    static bool postLanguage(Text::Language lang);
+
+    /**
+     * @brief Applique les messages en attente (tâche UI, sous le verrou UI)
+     * @param budgetUs Temps maximum
+     * @return Nombre de messages appliqués
+     */
+    static uint16_t drain(uint32_t budgetUs = UI_QUEUE_BUDGET_US);
+
+    static void printReport(Print& out);
+
+private:
+    struct Cell {
+        std::atomic<uint32_t> sequence;
+        UiMessage msg;
+    };
+
+    // Coalescing slots: one per UiKey, one for navigation, one for language
+    static constexpr uint8_t SLOT_VALUE = 0;
+    static constexpr uint8_t SLOT_NAVIGATE = static_cast<uint8_t>(UiKey::COUNT);
+    static constexpr uint8_t SLOT_LANGUAGE = SLOT_NAVIGATE + 1;
+    static constexpr uint8_t SLOT_COUNT = SLOT_LANGUAGE + 1;
+
+    struct TypeStats {
+        std::atomic<uint32_t> posted;
+        std::atomic<uint32_t> coalesced;
+        std::atomic<uint32_t> dropped;
+        uint32_t applied;
+        uint64_t latencySumUs;
+        uint32_t latencyMaxUs;
+    };
+
+    static Cell cells[CAPACITY];
+    static std::atomic<uint32_t> enqueuePos;
+    static uint32_t dequeuePos;
+    static std::atomic<uint32_t> pending[SLOT_COUNT];
+    static std::atomic<uint32_t> latest[SLOT_COUNT];
+    // Pending slots whose message did not fit in the queue (one bit per slot)
+    static std::atomic<uint32_t> stranded;
+    static std::atomic<uint32_t> strandedPosts;
+    static TypeStats stats[static_cast<uint8_t>(UiMsgType::COUNT)];
+    static PageManager* pages;
+    static bool ready;
+    static uint8_t depthPeak;
+    static uint32_t budgetStops;
+
+    static bool enqueue(const UiMessage& msg);
+    static bool dequeue(UiMessage& msg);
+    static uint8_t slotOf(UiMsgType type, uint8_t key);
+    static bool post(UiMsgType type, uint8_t key, uint32_t data, const char* text);
+    static void apply(const UiMessage& msg);
+    static void applyStranded();
+};
+
+#endif // UI_QUEUE_HPP
@@ -0,0 +1,198 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   UiStore.cpp                                    :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 22:41:37 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 22:41:37 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file UiStore.cpp
+ * @brief Live value store: per-frame coalesced updates of the visible page bindings.
+ */
+
+#include "UiStore.hpp"
+#include <Arduino.h>
+#include <string.h>
+
+static_assert(static_cast<uint8_t>(UiKey::COUNT) <= 32, "dirtyMask holds one bit per key");
+
+float UiStore::values[static_cast<uint8_t>(UiKey::COUNT)] = {};
+uint32_t UiStore::versions[static_cast<uint8_t>(UiKey::COUNT)] = {};
+uint32_t UiStore::dirtyMask = 0;
+UiStore::Binding UiStore::bindings[MAX_BINDINGS] = {};
+uint8_t UiStore::bindingCount = 0;
+const Page* UiStore::activePage = nullptr;
+lv_timer_t* UiStore::frameTimer = nullptr;
+
+uint32_t UiStore::setCount = 0;
+uint32_t UiStore::flushCount = 0;
+uint32_t UiStore::labelWrites = 0;
+uint32_t UiStore::labelSkips = 0;
+uint32_t UiStore::observerCalls = 0;
+
+/**
+ * @brief Creates the frame timer, paused until a value changes.
+ */
+void UiStore::begin() {
+    if (frameTimer) return;
+    frameTimer = lv_timer_create(on_frame, LV_DISP_DEF_REFR_PERIOD, nullptr);
+    lv_timer_pause(frameTimer);
+}
+
+/**
+ * @brief Stores a value and schedules the bindings update for the next frame.
+ * @param key Value to change.
+ * @param value New value.
+ */
+void UiStore::set(UiKey key, float value) {
+    uint8_t k = static_cast<uint8_t>(key);
+    if (k >= static_cast<uint8_t>(UiKey::COUNT)) return;
+    setCount++;
+    if (values[k] == value && versions[k] != 0) return;
+
+    values[k] = value;
+    versions[k]++;
+    if (!dirtyMask && frameTimer) lv_timer_resume(frameTimer);
+    dirtyMask |= 1u << k;
+}
+
+float UiStore::get(UiKey key) {
+    uint8_t k = static_cast<uint8_t>(key);
+    return k < static_cast<uint8_t>(UiKey::COUNT) ? values[k] : 0.0f;
+}
+
+UiStore::Binding* UiStore::addBinding(const Page* owner, UiKey key) {
+    if (bindingCount >= MAX_BINDINGS) {
+        Serial.printf("[UiStore] ERROR: binding table full (%u)\n", (unsigned)MAX_BINDINGS);
+        return nullptr;
+    }
+    Binding& b = bindings[bindingCount++];
+    b = Binding{};
+    b.owner = owner;
+    b.key = key;
+    return &b;
+}
+
+/**
+ * @brief Binds a label to a value. The label shows the current value right away.
+ * @param owner Page owning the label.
+ * @param key Value shown.
+ * @param label Label, its text points to the binding buffer.
+ * @param format Decimals and unit.
+ * @return False if the binding table is full.
+ */
+bool UiStore::bindLabel(const Page* owner, UiKey key, lv_obj_t* label, ValueFormat format) {
+    if (!label) return false;
+    Binding* b = addBinding(owner, key);
+    if (!b) return false;
+    b->label = label;
+    b->format = format;
+    apply(*b);
+    return true;
+}
+
+/**
+ * @brief Registers a change callback, called once now with the current value.
+ * @param owner Page owning the widgets touched by the callback.
+ * @param key Value observed.
+ * @param cb Callback.
+ * @param ctx User context for the callback.
+ * @return False if the binding table is full.
+ */
+bool UiStore::observe(const Page* owner, UiKey key, UiObserver cb, void* ctx) {
+    if (!cb) return false;
+    Binding* b = addBinding(owner, key);
+    if (!b) return false;
+    b->observer = cb;
+    b->ctx = ctx;
+    apply(*b);
+    return true;
+}
+
+/**
+ * @brief Removes the bindings of a page (its widgets are about to be deleted).
+ * @param owner Page.
+ */
+void UiStore::unbind(const Page* owner) {
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < bindingCount; i++) {
+        if (bindings[i].owner != owner) bindings[kept++] = bindings[i];
+    }
+    // Label text pointed to the moved buffers
+    for (uint8_t i = 0; i < kept; i++) {
+        if (bindings[i].label) lv_label_set_text_static(bindings[i].label, bindings[i].text);
+    }
+    bindingCount = kept;
+}
+
+/**
+ * @brief Sets the visible page and catches up its bindings.
+ * @param page Page now shown.
+ */
+void UiStore::setActivePage(const Page* page) {
+    activePage = page;
+    for (uint8_t i = 0; i < bindingCount; i++) {
+        Binding& b = bindings[i];
+        if (b.owner == page && b.seen != versions[static_cast<uint8_t>(b.key)]) apply(b);
+    }
+}
+
+/**
+ * @brief Pushes the current value to one binding.
+ * A label is only rewritten if its formatted text changed.
+ * @param binding Binding to update.
+ */
+void UiStore::apply(Binding& binding) {
+    uint8_t k = static_cast<uint8_t>(binding.key);
+    binding.seen = versions[k];
+
+    if (binding.label) {
+        char text[TEXT_LEN];
+        formatValue(text, sizeof(text), values[k], binding.format);
+        if (strcmp(text, binding.text) == 0 && lv_label_get_text(binding.label) == binding.text) {
+            labelSkips++;
+            return;
+        }
+        memcpy(binding.text, text, sizeof(text));
+        lv_label_set_text_static(binding.label, binding.text);
+        labelWrites++;
+    }
+    if (binding.observer) {
+        binding.observer(binding.ctx, binding.key, values[k]);
+        observerCalls++;
+    }
+}
+
+/**
+ * @brief Applies the values changed since the last frame to the visible page.
+ */
+void UiStore::flush() {
+    if (!dirtyMask) return;
+    uint32_t dirty = dirtyMask;
+    dirtyMask = 0;
+    flushCount++;
+
+    for (uint8_t i = 0; i < bindingCount; i++) {
+        Binding& b = bindings[i];
+        if (b.owner != activePage) continue;
+        if (dirty & (1u << static_cast<uint8_t>(b.key))) apply(b);
+    }
+}
+
+void UiStore::on_frame(lv_timer_t* timer) {
+    flush();
+    if (!dirtyMask) lv_timer_pause(timer);
+}
+
+void UiStore::printReport(Print& out) {
+    out.printf("=== UI store ===\n");
+    out.printf("bindings %u/%u  sets %lu  frames flushed %lu\n",
+               (unsigned)bindingCount, (unsigned)MAX_BINDINGS,
+               (unsigned long)setCount, (unsigned long)flushCount);
+    out.printf("labels written %lu  unchanged %lu  observer calls %lu\n",
+               (unsigned long)labelWrites, (unsigned long)labelSkips, (unsigned long)observerCalls);
+}
@@ -0,0 +1,127 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   UiStore.hpp                                    :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 22:41:37 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 22:41:37 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file UiStore.hpp
+ * @brief Observable live values (measurements, equipment state) bound to widgets.
+ */
+
+#ifndef UI_STORE_HPP
+#define UI_STORE_HPP
+
+#include <lvgl.h>
+#include <stdint.h>
+#include "Page.hpp"
+#include "ValueFormat.hpp"
+
+class Print;
+
+/**
+ * @brief Valeurs observables de l'interface
+ */
+enum class UiKey : uint8_t {
+    PH,
+    REDOX,
+    TEMPERATURE,
+    POWER_ON,
+    PUMP_ON,
+    PUMP_SPEED,
+    COUNT
+};
+
+/**
+ * @brief Appelé quand une valeur observée change (page visible uniquement)
+ */
+typedef void (*UiObserver)(void* ctx, UiKey key, float value);
+
+/**
+ * @class UiStore
+ * @brief Magasin de valeurs avec liaisons vers les widgets.
+ *
+ * set() ne touche pas LVGL : il marque la valeur comme modifiée. Une fois par
+ * trame, un timer LVGL applique les changements aux liaisons de la page
+ * visible ; plusieurs set() entre deux trames n'en font qu'une mise à jour.
+ * Un label n'est réécrit que si son texte formaté a changé. Les liaisons des
+ * pages cachées sont resynchronisées quand leur page redevient visible.
+ */
+class UiStore {
+public:
+    static constexpr uint8_t MAX_BINDINGS = 16;
+    static constexpr uint8_t TEXT_LEN = 16;
+
+    /**
+     * @brief Crée le timer de trame (après l'initialisation de LVGL)
+     */
+    static void begin();
+
+    /**
+     * @brief Change une valeur (sans effet si identique)
+     */
+    static void set(UiKey key, float value);
+    static float get(UiKey key);
+
+    /**
+     * @brief Lie un label à une valeur, formatée avec format (décimales + unité)
+     * @return false si la table des liaisons est pleine
+     */
+    static bool bindLabel(const Page* owner, UiKey key, lv_obj_t* label, ValueFormat format);
+
+    /**
+     * @brief Appelle cb à chaque changement de la valeur pendant que owner est visible
+     * @return false si la table des liaisons est pleine
+     */
+    static bool observe(const Page* owner, UiKey key, UiObserver cb, void* ctx);
+
+    /**
+     * @brief Supprime toutes les liaisons d'une page (à appeler avant de détruire ses widgets)
+     */
+    static void unbind(const Page* owner);
+
+    /**
+     * @brief Page visible : ses liaisons en retard sont mises à jour immédiatement
+     */
+    static void setActivePage(const Page* page);
+
+    static void printReport(Print& out);
+
+private:
+    struct Binding {
+        const Page* owner;
+        UiKey key;
+        uint32_t seen;
+        lv_obj_t* label;
+        ValueFormat format;
+        UiObserver observer;
+        void* ctx;
+        char text[TEXT_LEN];
+    };
+
+    static float values[static_cast<uint8_t>(UiKey::COUNT)];
+    static uint32_t versions[static_cast<uint8_t>(UiKey::COUNT)];
+    static uint32_t dirtyMask;
+    static Binding bindings[MAX_BINDINGS];
+    static uint8_t bindingCount;
+    static const Page* activePage;
+    static lv_timer_t* frameTimer;
+
+    static uint32_t setCount;
+    static uint32_t flushCount;
+    static uint32_t labelWrites;
+    static uint32_t labelSkips;
+    static uint32_t observerCalls;
+
+    static Binding* addBinding(const Page* owner, UiKey key);
+    static void apply(Binding& binding);
+    static void flush();
+    static void on_frame(lv_timer_t* timer);
+};
+
+#endif
@@ -0,0 +1,140 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   ValueFormat.cpp                                :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 23:16:04 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 23:16:04 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file ValueFormat.cpp
+ * @brief Fixed-point formatting of UI values, without newlib's float printf.
+ */
+
+#include "ValueFormat.hpp"
+#include <Arduino.h>
+#include <string.h>
+
+static constexpr const char* UNIT_SUFFIX[] = {
+    "",         // NONE
+    "",         // PH
+    " mV",      // MILLIVOLT
+    "\xC2\xB0" "C", // CELSIUS
+    "%",        // PERCENT
+    " sec",     // SECONDS
+    " min",     // MINUTES
+};
+static_assert(sizeof(UNIT_SUFFIX) / sizeof(UNIT_SUFFIX[0]) == static_cast<size_t>(Unit::COUNT),
+              "one suffix per unit");
+
+static constexpr float SCALE[Fmt::MAX_DECIMALS + 1] = {
+    1.0f, 10.0f, 100.0f, 1000.0f, 10000.0f
+};
+
+const char* unitSuffix(Unit unit) {
+    uint8_t u = static_cast<uint8_t>(unit);
+    return u < static_cast<uint8_t>(Unit::COUNT) ? UNIT_SUFFIX[u] : "";
+}
+
+/**
+ * @brief Writes a fixed-point integer with its unit.
+ * @param buf Output buffer.
+ * @param len Buffer size.
+ * @param scaled Value multiplied by 10^decimals.
+ * @param fmt Decimals and unit.
+ * @return Length written without the terminator, 0 (empty string) if it does not fit.
+ */
+size_t formatFixed(char* buf, size_t len, int32_t scaled, ValueFormat fmt) {
+    if (!buf || len == 0) return 0;
+    uint8_t decimals = fmt.decimals <= Fmt::MAX_DECIMALS ? fmt.decimals : Fmt::MAX_DECIMALS;
+
+    // Digits are produced backwards into a scratch buffer
+    char tmp[16];
+    char* p = tmp + sizeof(tmp);
+    bool negative = scaled < 0;
+    uint32_t magnitude = negative ? 0u - static_cast<uint32_t>(scaled) : static_cast<uint32_t>(scaled);
+
+    for (uint8_t i = 0; i < decimals; i++) {
+        *--p = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    }
+    if (decimals) *--p = '.';
+    do {
+        *--p = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude);
+    if (negative) *--p = '-';
+
+    size_t digits = static_cast<size_t>(tmp + sizeof(tmp) - p);
+    const char* suffix = unitSuffix(fmt.unit);
+    size_t suffixLen = strlen(suffix);
+    if (digits + suffixLen + 1 > len) {
+        buf[0] = '\0';
+        return 0;
+    }
+    memcpy(buf, p, digits);
+    memcpy(buf + digits, suffix, suffixLen + 1);
+    return digits + suffixLen;
+}
+
+/**
+ * @brief Rounds a float to the format precision and writes it.
+ * @param buf Output buffer.
+ * @param len Buffer size.
+ * @param value Value (NaN is written as "--").
+ * @param fmt Decimals and unit.
+ * @return Length written without the terminator, 0 if it does not fit.
+ */
+size_t formatValue(char* buf, size_t len, float value, ValueFormat fmt) {
+    if (!buf || len == 0) return 0;
+    if (value != value) {
+        if (len < 3) {
+            buf[0] = '\0';
+            return 0;
+        }
+        memcpy(buf, "--", 3);
+        return 2;
+    }
+
+    uint8_t decimals = fmt.decimals <= Fmt::MAX_DECIMALS ? fmt.decimals : Fmt::MAX_DECIMALS;
+    return formatFixed(buf, len, Fmt::roundScaled(value * SCALE[decimals]), ValueFormat{ decimals, fmt.unit });
+}
+
+/**
+ * @brief Times formatValue against snprintf("%.1f") on the same inputs.
+ * @param out Report output.
+ * @param iterations Calls per formatter.
+ */
+void benchmarkValueFormat(Print& out, uint32_t iterations) {
+    if (iterations == 0) return;
+    char buf[24];
+    volatile size_t sink = 0;
+
+    uint32_t start = ESP.getCycleCount();
+    for (uint32_t i = 0; i < iterations; i++) {
+        snprintf(buf, sizeof(buf), "%.1f\xC2\xB0" "C", 20.0f + (i & 127) * 0.1f);
+        sink = sink + buf[0];
+    }
+    uint32_t printfCycles = ESP.getCycleCount() - start;
+
+    start = ESP.getCycleCount();
+    for (uint32_t i = 0; i < iterations; i++) {
+        sink = sink + formatValue<1>(buf, sizeof(buf), 20.0f + (i & 127) * 0.1f, Unit::CELSIUS);
+    }
+    uint32_t fixedCycles = ESP.getCycleCount() - start;
+
+    start = ESP.getCycleCount();
+    for (uint32_t i = 0; i < iterations; i++) {
+        sink = sink + formatFixed(buf, sizeof(buf), static_cast<int32_t>(i & 127), Fmt::PERCENT);
+    }
+    uint32_t intCycles = ESP.getCycleCount() - start;
+
+    out.printf("=== Value format (%lu calls) ===\n", (unsigned long)iterations);
+    out.printf("snprintf %%.1f    : %lu cycles/call\n", (unsigned long)(printfCycles / iterations));
+    out.printf("formatValue<1>   : %lu cycles/call\n", (unsigned long)(fixedCycles / iterations));
+    out.printf("formatFixed int  : %lu cycles/call\n", (unsigned long)(intCycles / iterations));
+    (void)sink;
+}
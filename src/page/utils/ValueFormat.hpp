@@ -0,0 +1,111 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   ValueFormat.hpp                                :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 23:16:04 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 23:16:04 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file ValueFormat.hpp
+ * @brief Unit-aware number formatting with integer / fixed-point math (no printf).
+ */
+
+#ifndef VALUE_FORMAT_HPP
+#define VALUE_FORMAT_HPP
+
+#include <stdint.h>
+#include <stddef.h>
+
+class Print;
+
+/**
+ * @brief Unité affichée après la valeur
+ */
+enum class Unit : uint8_t {
+    NONE,
+    PH,         // sans suffixe
+    MILLIVOLT,  // " mV"
+    CELSIUS,    // "°C"
+    PERCENT,    // "%"
+    SECONDS,    // " sec"
+    MINUTES,    // " min"
+    COUNT
+};
+
+/**
+ * @brief Format constexpr : nombre de décimales et unité
+ */
+struct ValueFormat {
+    uint8_t decimals;
+    Unit unit;
+};
+
+namespace Fmt {
+    constexpr uint8_t MAX_DECIMALS = 4;
+
+    constexpr ValueFormat NONE = { 0, Unit::NONE };
+    constexpr ValueFormat PH = { 1, Unit::PH };
+    constexpr ValueFormat PH_PRECISE = { 2, Unit::PH };
+    constexpr ValueFormat REDOX = { 0, Unit::MILLIVOLT };
+    constexpr ValueFormat TEMPERATURE = { 1, Unit::CELSIUS };
+    constexpr ValueFormat PERCENT = { 0, Unit::PERCENT };
+    constexpr ValueFormat SECONDS = { 0, Unit::SECONDS };
+    constexpr ValueFormat MINUTES = { 0, Unit::MINUTES };
+
+    /**
+     * @brief 10^n à la compilation
+     */
+    constexpr int32_t pow10(uint8_t n) {
+        return n == 0 ? 1 : 10 * pow10(n - 1);
+    }
+
+    /**
+     * @brief Arrondit au plus proche une valeur déjà multipliée par 10^decimals
+     * (bornée à ±2e9 pour rester dans un int32_t)
+     */
+    inline int32_t roundScaled(float scaled) {
+        if (scaled > 2.0e9f) scaled = 2.0e9f;
+        if (scaled < -2.0e9f) scaled = -2.0e9f;
+        return static_cast<int32_t>(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+    }
+}
+
+/**
+ * @brief Suffixe d'une unité (chaîne en flash)
+ */
+const char* unitSuffix(Unit unit);
+
+/**
+ * @brief Écrit un entier à virgule fixe : scaled vaut valeur x 10^decimals
+ * @return longueur écrite (hors '\0'), 0 si buf est trop petit
+ */
+size_t formatFixed(char* buf, size_t len, int32_t scaled, ValueFormat fmt);
+
+/**
+ * @brief Arrondit un float à la précision du format puis l'écrit ("--" si NaN)
+ * @return longueur écrite (hors '\0'), 0 si buf est trop petit
+ */
+size_t formatValue(char* buf, size_t len, float value, ValueFormat fmt);
+
+/**
+ * @brief Variante à précision fixée à la compilation : le facteur 10^Decimals
+ * est une constante (pas de table ni de bornage des décimales à l'exécution)
+ */
+template <uint8_t Decimals>
+size_t formatValue(char* buf, size_t len, float value, Unit unit) {
+    static_assert(Decimals <= Fmt::MAX_DECIMALS, "formatValue: too many decimals");
+    constexpr float SCALE = static_cast<float>(Fmt::pow10(Decimals));
+    if (value != value) return formatValue(buf, len, value, ValueFormat{ Decimals, unit });
+    return formatFixed(buf, len, Fmt::roundScaled(value * SCALE), ValueFormat{ Decimals, unit });
+}
+
+/**
+ * @brief Compare formatValue à snprintf (cycles CPU par appel)
+ */
+void benchmarkValueFormat(Print& out, uint32_t iterations);
+
+#endif
@@ -0,0 +1,341 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   VirtualList.cpp                                :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 20:12:40 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 20:12:40 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file VirtualList.cpp
+ * @brief Implementation of the recycling virtual list widget.
+ */
+
+#include "VirtualList.hpp"
+#include "interface-utils-lvgl.hpp"
+#include <Arduino.h>
+
+// Distance (px) under which a press/release is treated as a tap
+static constexpr int32_t TAP_SLOP = 8;
+// Momentum timer period and minimal speed (px per tick) to keep scrolling
+static constexpr uint32_t MOMENTUM_PERIOD_MS = 16;
+static constexpr int32_t MOMENTUM_MIN_SPEED = 2;
+static constexpr lv_coord_t SCROLLBAR_WIDTH = 4;
+static constexpr lv_coord_t SCROLLBAR_MIN_HEIGHT = 20;
+static constexpr uint32_t NO_INDEX = UINT32_MAX;
+
+/**
+ * @brief Constructs an empty virtual list, no LVGL object is created yet.
+ */
+VirtualList::VirtualList()
+    : container(nullptr), scrollbar(nullptr), rowCount(0), rowHeight(0), viewHeight(0),
+      itemCount(0), offset(0), textCb(nullptr), selectCb(nullptr), ctx(nullptr),
+      momentumTimer(nullptr), velocity(0), dragDistance(0), rebinds(0) {
+    for (uint8_t i = 0; i < MAX_ROWS; i++) {
+        rows[i] = nullptr;
+        labels[i] = nullptr;
+        rowIndex[i] = NO_INDEX;
+    }
+}
+
+/**
+ * @brief Creates the list container and its row pool.
+ * @param parent Parent LVGL object.
+ * @param x X position.
+ * @param y Y position.
+ * @param width List width.
+ * @param height List height.
+ * @param rowHeight Fixed height of a row.
+ * @param text Row text provider.
+ * @param onSelect Row tap callback (may be nullptr).
+ * @param ctx User context passed to the callbacks.
+ * @return True on success.
+ */
+bool VirtualList::create(lv_obj_t* parent, int16_t x, int16_t y, lv_coord_t width, lv_coord_t height,
+                         lv_coord_t rowHeight, VirtualListText text, VirtualListSelect onSelect, void* ctx) {
+    if (container) {
+        Serial.println("[VirtualList] ERROR: already created");
+        return false;
+    }
+    if (!parent || !text || rowHeight <= 0 || height <= 0) {
+        Serial.println("[VirtualList] ERROR: invalid parameters in create()");
+        return false;
+    }
+
+    this->rowHeight = rowHeight;
+    this->viewHeight = height;
+    this->textCb = text;
+    this->selectCb = onSelect;
+    this->ctx = ctx;
+    offset = 0;
+
+    // Visible rows plus one partially shown at each edge
+    int needed = height / rowHeight + 2;
+    if (needed > MAX_ROWS) {
+        Serial.printf("[VirtualList] WARNING: %d rows needed, pool limited to %d\n", needed, MAX_ROWS);
+        needed = MAX_ROWS;
+    }
+    rowCount = (uint8_t)needed;
+
+    container = lv_obj_create(parent);
+    lv_obj_set_size(container, width, height);
+    lv_obj_set_pos(container, x, y);
+    lv_obj_add_style(container, LVGLStyles::shared(LVGLStyles::LIST), 0);
+    lv_obj_set_style_pad_all(container, 0, 0);
+    // Scrolling is done here, do not let LVGL scroll the container or its parents
+    lv_obj_clear_flag(container, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_clear_flag(container, LV_OBJ_FLAG_SCROLL_CHAIN);
+    lv_obj_add_event_cb(container, on_event, LV_EVENT_ALL, this);
+
+    for (uint8_t i = 0; i < rowCount; i++) {
+        lv_obj_t* row = lv_obj_create(container);
+        lv_obj_set_size(row, width - SCROLLBAR_WIDTH - 2, rowHeight);
+        lv_obj_add_style(row, LVGLStyles::shared(LVGLStyles::LIST_ITEM), 0);
+        lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_clear_flag(row, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+
+        lv_obj_t* label = lv_label_create(row);
+        lv_label_set_long_mode(label, LV_LABEL_LONG_DOT);
+        lv_obj_set_width(label, lv_pct(100));
+        lv_label_set_text(label, "");
+        lv_obj_align(label, LV_ALIGN_LEFT_MID, 0, 0);
+
+        rows[i] = row;
+        labels[i] = label;
+        rowIndex[i] = NO_INDEX;
+    }
+
+    scrollbar = lv_obj_create(container);
+    lv_obj_set_size(scrollbar, SCROLLBAR_WIDTH, SCROLLBAR_MIN_HEIGHT);
+    applyBgColor(scrollbar, LVGLStyles::COLOR_TEXT_SECONDARY);
+    lv_obj_set_style_border_width(scrollbar, 0, 0);
+    lv_obj_set_style_radius(scrollbar, SCROLLBAR_WIDTH / 2, 0);
+    lv_obj_clear_flag(scrollbar, LV_OBJ_FLAG_CLICKABLE);
+
+    layout(true);
+    return true;
+}
+
+/**
+ * @brief Sets the number of items, keeping the scroll position when possible.
+ * @param count New item count.
+ */
+void VirtualList::setCount(uint32_t count) {
+    itemCount = count;
+    if (offset > maxOffset()) {
+        offset = maxOffset();
+    }
+    if (container) {
+        layout(true);
+    }
+}
+
+/**
+ * @brief Reloads the text of every visible row.
+ */
+void VirtualList::refresh() {
+    if (container) {
+        layout(true);
+    }
+}
+
+/**
+ * @brief Scrolls so that an item is at the top of the list.
+ * @param index Item index.
+ */
+void VirtualList::scrollTo(uint32_t index) {
+    stopMomentum();
+    int64_t target = (int64_t)index * rowHeight;
+    offset = target > maxOffset() ? maxOffset() : (int32_t)target;
+    if (container) {
+        layout(false);
+    }
+}
+
+/**
+ * @brief Largest valid scroll offset for the current item count.
+ */
+int32_t VirtualList::maxOffset() const {
+    int64_t total = (int64_t)itemCount * rowHeight;
+    if (total <= viewHeight) {
+        return 0;
+    }
+    total -= viewHeight;
+    return total > INT32_MAX ? INT32_MAX : (int32_t)total;
+}
+
+/**
+ * @brief Moves the view by dy pixels (positive = content follows the finger down).
+ * @param dy Finger movement.
+ */
+void VirtualList::scrollBy(int32_t dy) {
+    int64_t next = (int64_t)offset - dy;
+    if (next < 0) next = 0;
+    if (next > maxOffset()) next = maxOffset();
+    if (next == offset) {
+        return;
+    }
+    offset = (int32_t)next;
+    layout(false);
+}
+
+/**
+ * @brief Places the pooled rows for the current offset.
+ * Rows map to items by index % rowCount, only rows whose item changed are rebound.
+ * @param rebindAll Reload text even for rows whose item did not change.
+ */
+void VirtualList::layout(bool rebindAll) {
+    uint32_t first = (uint32_t)(offset / rowHeight);
+
+    for (uint8_t k = 0; k < rowCount; k++) {
+        uint32_t index = first + k;
+        uint8_t slot = (uint8_t)(index % rowCount);
+        lv_obj_t* row = rows[slot];
+
+        if (index >= itemCount) {
+            if (rowIndex[slot] != NO_INDEX) {
+                lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+                rowIndex[slot] = NO_INDEX;
+            }
+            continue;
+        }
+
+        if (rebindAll || rowIndex[slot] != index) {
+            bindRow(slot, index);
+        }
+        lv_obj_set_y(row, (lv_coord_t)((int64_t)index * rowHeight - offset));
+    }
+
+    updateScrollbar();
+}
+
+/**
+ * @brief Loads the text of an item into a pooled row.
+ * @param slot Row slot.
+ * @param index Item index.
+ */
+void VirtualList::bindRow(uint8_t slot, uint32_t index) {
+    char buf[ROW_TEXT_LEN];
+    buf[0] = '\0';
+    const char* text = textCb(ctx, index, buf, sizeof(buf));
+    lv_label_set_text(labels[slot], text ? text : "");
+    if (rowIndex[slot] == NO_INDEX) {
+        lv_obj_clear_flag(rows[slot], LV_OBJ_FLAG_HIDDEN);
+    }
+    rowIndex[slot] = index;
+    rebinds++;
+}
+
+/**
+ * @brief Resizes and moves the scrollbar thumb, hidden when everything fits.
+ */
+void VirtualList::updateScrollbar() {
+    int32_t maxOff = maxOffset();
+    if (maxOff == 0) {
+        lv_obj_add_flag(scrollbar, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+    lv_obj_clear_flag(scrollbar, LV_OBJ_FLAG_HIDDEN);
+
+    int64_t total = (int64_t)itemCount * rowHeight;
+    lv_coord_t thumb = (lv_coord_t)((int64_t)viewHeight * viewHeight / total);
+    if (thumb < SCROLLBAR_MIN_HEIGHT) thumb = SCROLLBAR_MIN_HEIGHT;
+    lv_coord_t y = (lv_coord_t)((int64_t)offset * (viewHeight - thumb) / maxOff);
+
+    lv_obj_set_height(scrollbar, thumb);
+    lv_obj_set_pos(scrollbar, lv_obj_get_width(container) - SCROLLBAR_WIDTH - 1, y);
+}
+
+/**
+ * @brief Stops the momentum scrolling timer if running.
+ */
+void VirtualList::stopMomentum() {
+    if (momentumTimer) {
+        lv_timer_del(momentumTimer);
+        momentumTimer = nullptr;
+    }
+    velocity = 0;
+}
+
+/**
+ * @brief Container event handler: drag scrolling, momentum, taps and deletion.
+ * @param e LVGL event.
+ */
+void VirtualList::on_event(lv_event_t* e) {
+    VirtualList* list = (VirtualList*)lv_event_get_user_data(e);
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_indev_t* indev = lv_indev_get_act();
+
+    switch (code) {
+        case LV_EVENT_PRESSED:
+            list->stopMomentum();
+            list->dragDistance = 0;
+            break;
+
+        case LV_EVENT_PRESSING: {
+            if (!indev) break;
+            lv_point_t vect;
+            lv_indev_get_vect(indev, &vect);
+            list->dragDistance += vect.y < 0 ? -vect.y : vect.y;
+            list->velocity = vect.y;
+            list->scrollBy(vect.y);
+            break;
+        }
+
+        case LV_EVENT_RELEASED: {
+            if (list->dragDistance < TAP_SLOP) {
+                list->velocity = 0;
+                if (!indev || !list->selectCb) break;
+                lv_point_t point;
+                lv_area_t area;
+                lv_indev_get_point(indev, &point);
+                lv_obj_get_coords(list->container, &area);
+                int64_t pos = (int64_t)list->offset + (point.y - area.y1);
+                uint32_t index = (uint32_t)(pos / list->rowHeight);
+                if (pos >= 0 && index < list->itemCount) {
+                    list->selectCb(list->ctx, index);
+                }
+            } else if (list->velocity >= MOMENTUM_MIN_SPEED || list->velocity <= -MOMENTUM_MIN_SPEED) {
+                list->momentumTimer = lv_timer_create(on_momentum, MOMENTUM_PERIOD_MS, list);
+            }
+            break;
+        }
+
+        case LV_EVENT_DELETE:
+            // Rows are children of the container, LVGL frees them with it
+            list->stopMomentum();
+            list->container = nullptr;
+            list->scrollbar = nullptr;
+            for (uint8_t i = 0; i < MAX_ROWS; i++) {
+                list->rows[i] = nullptr;
+                list->labels[i] = nullptr;
+                list->rowIndex[i] = NO_INDEX;
+            }
+            list->rowCount = 0;
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Momentum tick: keeps scrolling with a decaying speed.
+ * @param timer LVGL timer (user_data is the list).
+ */
+void VirtualList::on_momentum(lv_timer_t* timer) {
+    VirtualList* list = (VirtualList*)timer->user_data;
+    int32_t before = list->offset;
+    list->scrollBy(list->velocity);
+    list->velocity = list->velocity * 7 / 8;
+
+    // Stop when slow enough or when an edge is reached
+    if (list->offset == before ||
+        (list->velocity < MOMENTUM_MIN_SPEED && list->velocity > -MOMENTUM_MIN_SPEED)) {
+        list->stopMomentum();
+    }
+}
@@ -0,0 +1,111 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   VirtualList.hpp                                :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 20:12:40 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 20:12:40 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file VirtualList.hpp
+ * @brief Scrolling list that recycles a fixed pool of rows over a data source.
+ */
+
+#ifndef VIRTUAL_LIST_HPP
+#define VIRTUAL_LIST_HPP
+
+#include <lvgl.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Fournit le texte d'une ligne. Peut écrire dans buf ou retourner une chaîne constante.
+ */
+typedef const char* (*VirtualListText)(void* ctx, uint32_t index, char* buf, size_t len);
+
+/**
+ * @brief Appelé quand l'utilisateur touche une ligne
+ */
+typedef void (*VirtualListSelect)(void* ctx, uint32_t index);
+
+/**
+ * @class VirtualList
+ * @brief Liste virtualisée : seules les lignes visibles existent dans LVGL.
+ *
+ * Le défilement est géré par la liste elle-même (décalage 32 bits), sans
+ * zone de contenu LVGL de la taille totale : la mémoire et le coût de rendu
+ * restent constants quel que soit le nombre d'éléments. Les lignes sont
+ * associées aux index en anneau (index % nombre de lignes), donc un
+ * défilement d'une ligne ne recharge qu'une seule ligne.
+ */
+class VirtualList {
+public:
+    static constexpr uint8_t MAX_ROWS = 12;
+    static constexpr uint8_t ROW_TEXT_LEN = 64;
+
+    VirtualList();
+
+    /**
+     * @brief Crée le conteneur et le pool de lignes
+     * @return false si déjà créée ou si les paramètres sont invalides
+     */
+    bool create(lv_obj_t* parent, int16_t x, int16_t y, lv_coord_t width, lv_coord_t height,
+                lv_coord_t rowHeight, VirtualListText text, VirtualListSelect onSelect, void* ctx);
+
+    /**
+     * @brief Change le nombre d'éléments de la source (garde la position si possible)
+     */
+    void setCount(uint32_t count);
+
+    /**
+     * @brief Recharge le texte de toutes les lignes visibles (données modifiées)
+     */
+    void refresh();
+
+    /**
+     * @brief Fait défiler jusqu'à placer l'élément en haut de la liste
+     */
+    void scrollTo(uint32_t index);
+
+    lv_obj_t* obj() const { return container; }
+    uint32_t count() const { return itemCount; }
+    uint8_t poolSize() const { return rowCount; }
+    uint32_t rebindCount() const { return rebinds; }
+
+private:
+    lv_obj_t* container;
+    lv_obj_t* scrollbar;
+    lv_obj_t* rows[MAX_ROWS];
+    lv_obj_t* labels[MAX_ROWS];
+    uint32_t rowIndex[MAX_ROWS];
+    uint8_t rowCount;
+
+    lv_coord_t rowHeight;
+    lv_coord_t viewHeight;
+    uint32_t itemCount;
+    int32_t offset;
+
+    VirtualListText textCb;
+    VirtualListSelect selectCb;
+    void* ctx;
+
+    lv_timer_t* momentumTimer;
+    int32_t velocity;
+    int32_t dragDistance;
+    uint32_t rebinds;
+
+    int32_t maxOffset() const;
+    void scrollBy(int32_t dy);
+    void layout(bool rebindAll);
+    void bindRow(uint8_t slot, uint32_t index);
+    void updateScrollbar();
+    void stopMomentum();
+
+    static void on_event(lv_event_t* e);
+    static void on_momentum(lv_timer_t* timer);
+};
+
+#endif // VIRTUAL_LIST_HPP
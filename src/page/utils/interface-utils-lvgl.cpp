@@ -18,6 +18,17 @@
  */
 
 #include "interface-utils-lvgl.hpp"
+#include "Notifications.hpp"
+#include "TextBindings.hpp"
+#include "../../screen/LVGLArena.hpp"
+
+#if __has_include(<esp_memory_utils.h>)
+#include <esp_memory_utils.h>
+#else
+#include <soc/soc_memory_layout.h>
+#endif
+
+static LabelTextStats textStats = {};
 
 namespace LVGLStyles {
     const lv_font_t* FONT_SMALL = &lv_font_montserrat_14;
@@ -25,6 +36,212 @@ namespace LVGLStyles {
     const lv_font_t* FONT_MEDIUM = &lv_font_montserrat_20;
     const lv_font_t* FONT_LARGE = &lv_font_montserrat_24;
     const lv_font_t* FONT_XLARGE = &lv_font_montserrat_28;
+
+    // Registre de styles partagés : les objets référencent ces lv_style_t
+    // au lieu de porter chacun leurs propres styles locaux dans le tas LVGL.
+    static lv_style_t sharedStyles[SHARED_STYLE_COUNT];
+    static bool sharedReady = false;
+
+    static constexpr uint8_t BG_STYLE_MAX = 12;
+    static constexpr uint8_t TEXT_STYLE_MAX = 16;
+
+    struct BgStyle {
+        uint32_t color;
+        lv_style_t style;
+    };
+
+    struct TextStyle {
+        const lv_font_t* font;
+        uint32_t color;
+        lv_style_t style;
+    };
+
+    static BgStyle bgStyles[BG_STYLE_MAX];
+    static uint8_t bgStyleCount = 0;
+    static TextStyle textStyles[TEXT_STYLE_MAX];
+    static uint8_t textStyleCount = 0;
+
+    // Les styles vivent plus longtemps que la page qui les crée : arène partagée
+    static void initSharedStyles() {
+        LVGLArena::Scope arena(LVGLArena::SHARED);
+        for (auto& st : sharedStyles) lv_style_init(&st);
+
+        lv_style_t* st = &sharedStyles[CARD];
+        lv_style_set_bg_color(st, color(COLOR_WHITE));
+        lv_style_set_radius(st, 10);
+        lv_style_set_shadow_width(st, 8);
+        lv_style_set_shadow_opa(st, LV_OPA_20);
+        lv_style_set_border_width(st, 0);
+        lv_style_set_pad_all(st, 10);
+
+        st = &sharedStyles[BUTTON];
+        lv_style_set_radius(st, 8);
+        lv_style_set_shadow_width(st, 4);
+        lv_style_set_shadow_opa(st, LV_OPA_30);
+
+        st = &sharedStyles[BUTTON_LABEL];
+        lv_style_set_text_font(st, FONT_NORMAL);
+        lv_style_set_text_color(st, color(COLOR_WHITE));
+
+        st = &sharedStyles[ICON_BUTTON];
+        lv_style_set_radius(st, LV_RADIUS_CIRCLE);
+
+        st = &sharedStyles[ICON_LABEL];
+        lv_style_set_text_font(st, FONT_LARGE);
+        lv_style_set_text_color(st, color(COLOR_WHITE));
+
+        st = &sharedStyles[NAVBAR];
+        lv_style_set_bg_color(st, color(COLOR_PRIMARY));
+        lv_style_set_radius(st, 0);
+        lv_style_set_border_width(st, 0);
+        lv_style_set_pad_all(st, 10);
+
+        st = &sharedStyles[NAVBAR_TITLE];
+        lv_style_set_text_font(st, FONT_MEDIUM);
+        lv_style_set_text_color(st, color(COLOR_WHITE));
+
+        st = &sharedStyles[LIST];
+        lv_style_set_bg_color(st, color(COLOR_WHITE));
+        lv_style_set_radius(st, 10);
+        lv_style_set_pad_row(st, 5);
+
+        st = &sharedStyles[LIST_ITEM];
+        lv_style_set_bg_color(st, color(COLOR_WHITE));
+        lv_style_set_border_width(st, 0);
+        lv_style_set_pad_all(st, 10);
+
+        st = &sharedStyles[SLIDER_INDICATOR];
+        lv_style_set_bg_color(st, color(COLOR_PRIMARY));
+
+        st = &sharedStyles[MODAL_OVERLAY];
+        lv_style_set_bg_color(st, color(COLOR_BLACK));
+        lv_style_set_bg_opa(st, LV_OPA_50);
+        lv_style_set_border_width(st, 0);
+
+        st = &sharedStyles[MODAL];
+        lv_style_set_bg_color(st, color(COLOR_WHITE));
+        lv_style_set_radius(st, 10);
+        lv_style_set_shadow_width(st, 20);
+        lv_style_set_shadow_opa(st, LV_OPA_50);
+
+        st = &sharedStyles[TOAST];
+        lv_style_set_bg_color(st, color(COLOR_TEXT_PRIMARY));
+        lv_style_set_bg_opa(st, LV_OPA_90);
+        lv_style_set_radius(st, 5);
+        lv_style_set_pad_all(st, 15);
+
+        st = &sharedStyles[TOAST_LABEL];
+        lv_style_set_text_color(st, color(COLOR_WHITE));
+
+        sharedReady = true;
+    }
+
+    lv_style_t* shared(SharedStyle id) {
+        if (!sharedReady) initSharedStyles();
+        return &sharedStyles[id];
+    }
+
+    lv_style_t* background(uint32_t hex) {
+        for (uint8_t i = 0; i < bgStyleCount; i++) {
+            if (bgStyles[i].color == hex) return &bgStyles[i].style;
+        }
+        if (bgStyleCount >= BG_STYLE_MAX) {
+            Serial.printf("[LVGLStyles] background style table full (0x%06lX)\n", (unsigned long)hex);
+            return nullptr;
+        }
+        LVGLArena::Scope arena(LVGLArena::SHARED);
+        BgStyle& entry = bgStyles[bgStyleCount++];
+        entry.color = hex;
+        lv_style_init(&entry.style);
+        lv_style_set_bg_color(&entry.style, color(hex));
+        return &entry.style;
+    }
+
+    lv_style_t* text(const lv_font_t* font, uint32_t hex) {
+        for (uint8_t i = 0; i < textStyleCount; i++) {
+            if (textStyles[i].font == font && textStyles[i].color == hex) return &textStyles[i].style;
+        }
+        if (textStyleCount >= TEXT_STYLE_MAX) {
+            Serial.printf("[LVGLStyles] text style table full (0x%06lX)\n", (unsigned long)hex);
+            return nullptr;
+        }
+        LVGLArena::Scope arena(LVGLArena::SHARED);
+        TextStyle& entry = textStyles[textStyleCount++];
+        entry.font = font;
+        entry.color = hex;
+        lv_style_init(&entry.style);
+        lv_style_set_text_font(&entry.style, font);
+        lv_style_set_text_color(&entry.style, color(hex));
+        return &entry.style;
+    }
+}
+
+/**
+ * @brief Apply a background color through the shared style registry.
+ * Falls back to a local style when the registry table is full.
+ * @param obj LVGL object.
+ * @param color Background color (hex).
+ */
+void applyBgColor(lv_obj_t* obj, uint32_t color) {
+    lv_style_t* st = LVGLStyles::background(color);
+    if (st) lv_obj_add_style(obj, st, 0);
+    else lv_obj_set_style_bg_color(obj, LVGLStyles::color(color), 0);
+}
+
+/**
+ * @brief Apply a font and text color through the shared style registry.
+ * Falls back to local styles when the registry table is full.
+ * @param obj LVGL object.
+ * @param font Font to use.
+ * @param color Text color (hex).
+ */
+void applyTextStyle(lv_obj_t* obj, const lv_font_t* font, uint32_t color) {
+    lv_style_t* st = LVGLStyles::text(font, color);
+    if (st) {
+        lv_obj_add_style(obj, st, 0);
+    } else {
+        lv_obj_set_style_text_font(obj, font, 0);
+        lv_obj_set_style_text_color(obj, LVGLStyles::color(color), 0);
+    }
+}
+
+/**
+ * @brief Tell whether a string lives in flash (.rodata) for the whole program.
+ * String literals and the Text translation tables are placed there.
+ * @param text String to check.
+ * @return True if the string can be referenced without a copy.
+ */
+bool isStaticText(const char* text) {
+    return text && esp_ptr_in_drom(text);
+}
+
+/**
+ * @brief Set a label text, referencing flash strings instead of copying them.
+ * Text in RAM (stack buffers, members) is copied into the LVGL heap as usual.
+ * Labels in LV_LABEL_LONG_DOT mode always copy: LVGL writes the dots into the text.
+ * @param label LVGL label object.
+ * @param text Text to display.
+ */
+void setLabelText(lv_obj_t* label, const char* text) {
+    if (!text) text = "";
+    size_t bytes = strlen(text) + 1;
+    if (isStaticText(text) && lv_label_get_long_mode(label) != LV_LABEL_LONG_DOT) {
+        lv_label_set_text_static(label, text);
+        textStats.staticLabels++;
+        textStats.staticBytes += bytes;
+    } else {
+        lv_label_set_text(label, text);
+        textStats.copiedLabels++;
+        textStats.copiedBytes += bytes;
+    }
+}
+
+/**
+ * @brief Get the cumulated static/copied label text counters.
+ * @return Counters since boot.
+ */
+const LabelTextStats& labelTextStats() {
+    return textStats;
 }
 
 /**
@@ -40,12 +257,7 @@ lv_obj_t* createCard(lv_obj_t* parent, int16_t x, int16_t y, lv_coord_t width, l
     lv_obj_t* card = lv_obj_create(parent);
     lv_obj_set_size(card, width, height);
     lv_obj_set_pos(card, x, y);
-    lv_obj_set_style_bg_color(card, lv_color_hex(LVGLStyles::COLOR_WHITE), 0);
-    lv_obj_set_style_radius(card, 10, 0);
-    lv_obj_set_style_shadow_width(card, 8, 0);
-    lv_obj_set_style_shadow_opa(card, LV_OPA_20, 0);
-    lv_obj_set_style_border_width(card, 0, 0);
-    lv_obj_set_style_pad_all(card, 10, 0);
+    lv_obj_add_style(card, LVGLStyles::shared(LVGLStyles::CARD), 0);
     return card;
 }
 
@@ -66,15 +278,15 @@ lv_obj_t* createButton(lv_obj_t* parent, int16_t x, int16_t y, lv_coord_t width,
     lv_obj_t* btn = lv_btn_create(parent);
     lv_obj_set_size(btn, width, height);
     lv_obj_set_pos(btn, x, y);
-    lv_obj_set_style_bg_color(btn, lv_color_hex(color), 0);
-    lv_obj_set_style_radius(btn, border_radius, 0);
-    lv_obj_set_style_shadow_width(btn, 4, 0);
-    lv_obj_set_style_shadow_opa(btn, LV_OPA_30, 0);
+    lv_obj_add_style(btn, LVGLStyles::shared(LVGLStyles::BUTTON), 0);
+    applyBgColor(btn, color);
+    if (border_radius != 8) {
+        lv_obj_set_style_radius(btn, border_radius, 0);
+    }
     
     lv_obj_t* label = lv_label_create(btn);
-    lv_label_set_text(label, text);
-    lv_obj_set_style_text_font(label, LVGLStyles::FONT_NORMAL, 0);
-    lv_obj_set_style_text_color(label, lv_color_hex(LVGLStyles::COLOR_WHITE), 0);
+    setLabelText(label, text);
+    lv_obj_add_style(label, LVGLStyles::shared(LVGLStyles::BUTTON_LABEL), 0);
     lv_obj_center(label);
     
     return btn;
@@ -93,10 +305,9 @@ lv_obj_t* createButton(lv_obj_t* parent, int16_t x, int16_t y, lv_coord_t width,
 lv_obj_t* createLabel(lv_obj_t* parent, int16_t x, int16_t y, const char* text,
                       const lv_font_t* font, uint32_t color) {
     lv_obj_t* label = lv_label_create(parent);
-    lv_label_set_text(label, text);
+    setLabelText(label, text);
     lv_obj_set_pos(label, x, y);
-    lv_obj_set_style_text_font(label, font, 0);
-    lv_obj_set_style_text_color(label, lv_color_hex(color), 0);
+    applyTextStyle(label, font, color);
     return label;
 }
 
@@ -109,9 +320,7 @@ lv_obj_t* createLabel(lv_obj_t* parent, int16_t x, int16_t y, const char* text,
  * @return Pointer to the created LVGL title label object.
  */
 lv_obj_t* createTitle(lv_obj_t* parent, int16_t x, int16_t y, const char* text) {
-    lv_obj_t* title = createLabel(parent, x, y, text, LVGLStyles::FONT_LARGE, LVGLStyles::COLOR_TEXT_PRIMARY);
-    lv_obj_set_style_text_font(title, LVGLStyles::FONT_LARGE, 0);
-    return title;
+    return createLabel(parent, x, y, text, LVGLStyles::FONT_LARGE, LVGLStyles::COLOR_TEXT_PRIMARY);
 }
 
 /**
@@ -149,7 +358,7 @@ lv_obj_t* createSlider(lv_obj_t* parent, int16_t x, int16_t y, lv_coord_t width,
     lv_obj_set_pos(slider, x, y);
     lv_slider_set_range(slider, min_value, max_value);
     lv_slider_set_value(slider, initial_value, LV_ANIM_OFF);
-    lv_obj_set_style_bg_color(slider, lv_color_hex(LVGLStyles::COLOR_PRIMARY), LV_PART_INDICATOR);
+    lv_obj_add_style(slider, LVGLStyles::shared(LVGLStyles::SLIDER_INDICATOR), LV_PART_INDICATOR);
     return slider;
 }
 
@@ -161,15 +370,31 @@ lv_obj_t* createSlider(lv_obj_t* parent, int16_t x, int16_t y, lv_coord_t width,
  * @param width Text area width.
  * @param height Text area height.
  * @param placeholder Placeholder text.
+ * @param mode Input mode, selects the shared keyboard preset on click.
  * @return Pointer to the created LVGL text area object.
  */
 lv_obj_t* createTextArea(lv_obj_t* parent, int16_t x, int16_t y, lv_coord_t width, lv_coord_t height,
-                         const char* placeholder) {
+                         const char* placeholder, InputMode mode) {
     lv_obj_t* ta = lv_textarea_create(parent);
     lv_obj_set_size(ta, width, height);
     lv_obj_set_pos(ta, x, y);
     lv_textarea_set_placeholder_text(ta, placeholder);
     lv_textarea_set_one_line(ta, height < 40);
+
+    switch (mode) {
+        case InputMode::NUMBER:
+            lv_textarea_set_accepted_chars(ta, "0123456789");
+            lv_textarea_set_max_length(ta, 5);
+            break;
+        case InputMode::PASSWORD:
+            lv_textarea_set_password_mode(ta, true);
+            break;
+        default:
+            break;
+    }
+
+    // Clicks bubble to the page, which opens the shared keyboard
+    setWidgetId(ta, WIDGET_INPUT_BASE + static_cast<uint8_t>(mode));
     return ta;
 }
 
@@ -211,16 +436,14 @@ lv_obj_t* createMeasurementCard(lv_obj_t* parent, int16_t x, int16_t y, lv_coord
     
     // Titre
     lv_obj_t* label_title = lv_label_create(card);
-    lv_label_set_text(label_title, title);
-    lv_obj_set_style_text_font(label_title, LVGLStyles::FONT_SMALL, 0);
-    lv_obj_set_style_text_color(label_title, lv_color_hex(LVGLStyles::COLOR_TEXT_SECONDARY), 0);
+    setLabelText(label_title, title);
+    applyTextStyle(label_title, LVGLStyles::FONT_SMALL, LVGLStyles::COLOR_TEXT_SECONDARY);
     lv_obj_align(label_title, LV_ALIGN_TOP_LEFT, 0, 0);
     
     // Valeur
     lv_obj_t* label_value = lv_label_create(card);
-    lv_label_set_text(label_value, value);
-    lv_obj_set_style_text_font(label_value, value_font, 0);
-    lv_obj_set_style_text_color(label_value, lv_color_hex(value_color), 0);
+    setLabelText(label_value, value);
+    applyTextStyle(label_value, value_font, value_color);
     lv_obj_align(label_value, LV_ALIGN_CENTER, 0, 5);
     
     return card;
@@ -241,13 +464,12 @@ lv_obj_t* createIconButton(lv_obj_t* parent, int16_t x, int16_t y, lv_coord_t si
     lv_obj_t* btn = lv_btn_create(parent);
     lv_obj_set_size(btn, size, size);
     lv_obj_set_pos(btn, x, y);
-    lv_obj_set_style_bg_color(btn, lv_color_hex(color), 0);
-    lv_obj_set_style_radius(btn, size / 2, 0); // Circulaire
+    lv_obj_add_style(btn, LVGLStyles::shared(LVGLStyles::ICON_BUTTON), 0); // Circulaire
+    applyBgColor(btn, color);
     
     lv_obj_t* label = lv_label_create(btn);
-    lv_label_set_text(label, icon);
-    lv_obj_set_style_text_font(label, LVGLStyles::FONT_LARGE, 0);
-    lv_obj_set_style_text_color(label, lv_color_hex(LVGLStyles::COLOR_WHITE), 0);
+    setLabelText(label, icon);
+    lv_obj_add_style(label, LVGLStyles::shared(LVGLStyles::ICON_LABEL), 0);
     lv_obj_center(label);
     
     return btn;
@@ -263,96 +485,26 @@ lv_obj_t* createNavBar(lv_obj_t* parent, const char* title) {
     lv_obj_t* navbar = lv_obj_create(parent);
     lv_obj_set_size(navbar, 480, 50);
     lv_obj_set_pos(navbar, 0, 0);
-    lv_obj_set_style_bg_color(navbar, lv_color_hex(LVGLStyles::COLOR_PRIMARY), 0);
-    lv_obj_set_style_radius(navbar, 0, 0);
-    lv_obj_set_style_border_width(navbar, 0, 0);
-    lv_obj_set_style_pad_all(navbar, 10, 0);
+    lv_obj_add_style(navbar, LVGLStyles::shared(LVGLStyles::NAVBAR), 0);
     
     lv_obj_t* label = lv_label_create(navbar);
-    lv_label_set_text(label, title);
-    lv_obj_set_style_text_font(label, LVGLStyles::FONT_MEDIUM, 0);
-    lv_obj_set_style_text_color(label, lv_color_hex(LVGLStyles::COLOR_WHITE), 0);
+    setLabelText(label, title);
+    lv_obj_add_style(label, LVGLStyles::shared(LVGLStyles::NAVBAR_TITLE), 0);
     lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 0);
     
     return navbar;
 }
 
-/**
- * @brief Create a modal dialog overlay.
- * @param parent Parent LVGL object.
- * @param width Modal width.
- * @param height Modal height.
- * @param title Modal title text.
- * @return Pointer to the created LVGL overlay object.
- */
-lv_obj_t* createModal(lv_obj_t* parent, lv_coord_t width, lv_coord_t height, const char* title) {
-    // Overlay sombre
-    lv_obj_t* overlay = lv_obj_create(parent);
-    lv_obj_set_size(overlay, 480, 320);
-    lv_obj_set_style_bg_color(overlay, lv_color_hex(LVGLStyles::COLOR_BLACK), 0);
-    lv_obj_set_style_bg_opa(overlay, LV_OPA_50, 0);
-    lv_obj_set_style_border_width(overlay, 0, 0);
-    
-    // Modal
-    lv_obj_t* modal = lv_obj_create(overlay);
-    lv_obj_set_size(modal, width, height);
-    lv_obj_center(modal);
-    lv_obj_set_style_bg_color(modal, lv_color_hex(LVGLStyles::COLOR_WHITE), 0);
-    lv_obj_set_style_radius(modal, 10, 0);
-    lv_obj_set_style_shadow_width(modal, 20, 0);
-    lv_obj_set_style_shadow_opa(modal, LV_OPA_50, 0);
-    
-    // Titre
-    if (title) {
-        lv_obj_t* label_title = lv_label_create(modal);
-        lv_label_set_text(label_title, title);
-        lv_obj_set_style_text_font(label_title, LVGLStyles::FONT_MEDIUM, 0);
-        lv_obj_align(label_title, LV_ALIGN_TOP_MID, 0, 10);
-    }
-    
-    return overlay;
-}
-
-/**
- * @brief Close and delete a modal dialog.
- * @param modal Pointer to the modal overlay object.
- */
-void closeModal(lv_obj_t* modal) {
-    if (modal) {
-        lv_obj_del(modal);
-    }
-}
-
 /**
  * @brief Show a temporary toast message.
- * @param parent Parent LVGL object.
- * @param message Message text to display.
+ * Forwards to the pooled Notifications toast: no object is created per call.
+ * @param parent Unused, the toast lives on the top layer.
+ * @param message Message text to display (copied).
  * @param duration_ms Duration in milliseconds before disappearing.
  */
 void showToast(lv_obj_t* parent, const char* message, uint32_t duration_ms) {
-    lv_obj_t* toast = lv_obj_create(parent);
-    lv_obj_set_size(toast, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-    lv_obj_set_style_bg_color(toast, lv_color_hex(LVGLStyles::COLOR_TEXT_PRIMARY), 0);
-    lv_obj_set_style_bg_opa(toast, LV_OPA_90, 0);
-    lv_obj_set_style_radius(toast, 5, 0);
-    lv_obj_set_style_pad_all(toast, 15, 0);
-    
-    lv_obj_t* label = lv_label_create(toast);
-    lv_label_set_text(label, message);
-    lv_obj_set_style_text_color(label, lv_color_hex(LVGLStyles::COLOR_WHITE), 0);
-    
-    lv_obj_align(toast, LV_ALIGN_BOTTOM_MID, 0, -20);
-    
-    // Animation de disparition
-    lv_anim_t a;
-    lv_anim_init(&a);
-    lv_anim_set_var(&a, toast);
-    lv_anim_set_time(&a, 300);
-    lv_anim_set_delay(&a, duration_ms);
-    lv_anim_set_exec_cb(&a, (lv_anim_exec_xcb_t)lv_obj_set_y);
-    lv_anim_set_values(&a, lv_obj_get_y(toast), 350);
-    lv_anim_set_ready_cb(&a, [](lv_anim_t* a) { lv_obj_del((lv_obj_t*)a->var); });
-    lv_anim_start(&a);
+    (void)parent;
+    Notifications::toast(message, duration_ms);
 }
 
 /**
@@ -368,10 +520,8 @@ lv_obj_t* createScrollableList(lv_obj_t* parent, int16_t x, int16_t y, lv_coord_
     lv_obj_t* list = lv_obj_create(parent);
     lv_obj_set_size(list, width, height);
     lv_obj_set_pos(list, x, y);
-    lv_obj_set_style_bg_color(list, lv_color_hex(LVGLStyles::COLOR_WHITE), 0);
-    lv_obj_set_style_radius(list, 10, 0);
+    lv_obj_add_style(list, LVGLStyles::shared(LVGLStyles::LIST), 0);
     lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_style_pad_row(list, 5, 0);
     return list;
 }
 
@@ -386,18 +536,16 @@ lv_obj_t* addListItem(lv_obj_t* list, const char* text, const char* icon) {
     lv_obj_t* item = lv_obj_create(list);
     lv_obj_set_width(item, lv_pct(100));
     lv_obj_set_height(item, LV_SIZE_CONTENT);
-    lv_obj_set_style_bg_color(item, lv_color_hex(LVGLStyles::COLOR_WHITE), 0);
-    lv_obj_set_style_border_width(item, 0, 0);
-    lv_obj_set_style_pad_all(item, 10, 0);
+    lv_obj_add_style(item, LVGLStyles::shared(LVGLStyles::LIST_ITEM), 0);
     
     if (icon) {
         lv_obj_t* label_icon = lv_label_create(item);
-        lv_label_set_text(label_icon, icon);
+        setLabelText(label_icon, icon);
         lv_obj_align(label_icon, LV_ALIGN_LEFT_MID, 0, 0);
     }
     
     lv_obj_t* label_text = lv_label_create(item);
-    lv_label_set_text(label_text, text);
+    setLabelText(label_text, text);
     lv_obj_align(label_text, icon ? LV_ALIGN_LEFT_MID : LV_ALIGN_LEFT_MID, icon ? 40 : 0, 0);
     
     return item;
@@ -437,7 +585,7 @@ void fade_to_screen(lv_obj_t* new_screen, uint16_t time_ms) {
     lv_obj_t* overlay = lv_obj_create(lv_layer_top());
     lv_obj_set_size(overlay, w, h);
     lv_obj_set_pos(overlay, 0, 0);
-    lv_obj_set_style_bg_color(overlay, lv_color_hex(LVGLStyles::COLOR_BLACK), 0);
+    lv_obj_set_style_bg_color(overlay, LVGLStyles::color(LVGLStyles::COLOR_BLACK), 0);
     lv_obj_set_style_bg_opa(overlay, LV_OPA_0, 0);
     lv_obj_set_style_border_width(overlay, 0, 0);
     lv_obj_set_style_pad_all(overlay, 0, 0);
@@ -475,3 +623,162 @@ void fade_to_screen(lv_obj_t* new_screen, uint16_t time_ms) {
     });
     lv_anim_start(&a_out);
 }
+
+/**
+ * @brief Tag a widget for event delegation.
+ * Its events bubble up to the screen, where a single callback dispatches them.
+ * @param obj Widget.
+ * @param id Widget ID, unique within the page.
+ */
+void setWidgetId(lv_obj_t* obj, uint8_t id) {
+    lv_obj_set_user_data(obj, (void*)(intptr_t)(id + 1));
+    for (lv_obj_t* o = obj; o && lv_obj_get_parent(o); o = lv_obj_get_parent(o)) {
+        lv_obj_add_flag(o, LV_OBJ_FLAG_EVENT_BUBBLE);
+    }
+}
+
+/**
+ * @brief Get the ID set by setWidgetId().
+ * @param obj Widget.
+ * @return The ID, or -1 if the widget was not tagged.
+ */
+int widgetId(const lv_obj_t* obj) {
+    intptr_t raw = obj ? (intptr_t)lv_obj_get_user_data((lv_obj_t*)obj) : 0;
+    return (raw > 0 && raw <= 256) ? (int)raw - 1 : -1;
+}
+
+/**
+ * @brief Handle a delegated event coming from a layout element.
+ * The widget ID is the index of its WidgetSpec.
+ * @param binding Layout binding of the page.
+ * @param index Widget ID.
+ * @param code Event code.
+ * @param target Widget that sent the event.
+ * @return True if the event belonged to the layout.
+ */
+bool handleLayoutEvent(const LayoutBinding* binding, uint8_t index, lv_event_code_t code, lv_obj_t* target) {
+    if (!binding || index >= binding->count) return false;
+
+    const WidgetSpec& spec = binding->specs[index];
+    int32_t value = 0;
+
+    switch (spec.kind) {
+        case WidgetKind::SWITCH:
+            if (code != LV_EVENT_VALUE_CHANGED) return false;
+            value = lv_obj_has_state(target, LV_STATE_CHECKED) ? 1 : 0;
+            binding->values[spec.slot] = value;
+            break;
+        case WidgetKind::SLIDER: {
+            if (code != LV_EVENT_VALUE_CHANGED) return false;
+            value = lv_slider_get_value(target);
+            binding->values[spec.slot] = value;
+            LayoutSlot& slot = binding->slots[spec.slot];
+            if (slot.valueLabel) {
+                formatFixed(slot.text, sizeof(slot.text), value, spec.format);
+                lv_label_set_text_static(slot.valueLabel, slot.text);
+            }
+            break;
+        }
+        case WidgetKind::BUTTON:
+            if (code != LV_EVENT_CLICKED) return false;
+            break;
+        default:
+            return false;
+    }
+
+    if (binding->onChange) binding->onChange(binding->owner, spec, value);
+    return true;
+}
+
+void buildLayoutItem(lv_obj_t* parent, const LayoutBinding* binding, uint8_t index, Text::Language lang) {
+    if (!parent || !binding || index >= binding->count) return;
+
+    const WidgetSpec& spec = binding->specs[index];
+    const char* text = Text::get(spec.text, lang);
+
+    switch (spec.kind) {
+        case WidgetKind::TITLE: {
+            lv_obj_t* title = createLabel(parent, spec.x, spec.y, text,
+                                          LVGLStyles::FONT_MEDIUM, LVGLStyles::COLOR_TEXT_PRIMARY);
+            TextBindings::bind(binding->owner, title, spec.text);
+            lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 0);
+            break;
+        }
+        case WidgetKind::SWITCH: {
+            lv_obj_t* card = createCard(parent, spec.x, spec.y, 420, 70);
+            lv_obj_t* label = createLabel(card, 20, 20, text, LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
+            TextBindings::bind(binding->owner, label, spec.text);
+            lv_obj_t* sw = createSwitch(card, 350, 20, binding->values[spec.slot] != 0);
+            setWidgetId(sw, index);
+            binding->slots[spec.slot].widget = sw;
+            break;
+        }
+        case WidgetKind::SLIDER: {
+            lv_obj_t* card = createCard(parent, spec.x, spec.y, 420, 100);
+            lv_obj_t* label = createLabel(card, 20, 10, text, LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_PRIMARY);
+            TextBindings::bind(binding->owner, label, spec.text);
+            lv_obj_t* slider = createSlider(card, 20, 40, 380, spec.min, spec.max, binding->values[spec.slot]);
+            setWidgetId(slider, index);
+
+            LayoutSlot& slot = binding->slots[spec.slot];
+            formatFixed(slot.text, sizeof(slot.text), binding->values[spec.slot], spec.format);
+            lv_obj_t* value_label = createLabel(card, 350, 10, "", LVGLStyles::FONT_NORMAL, LVGLStyles::COLOR_TEXT_SECONDARY);
+            lv_label_set_text_static(value_label, slot.text);
+            slot.widget = slider;
+            slot.valueLabel = value_label;
+            break;
+        }
+        case WidgetKind::BUTTON: {
+            lv_obj_t* btn = createButton(parent, spec.x, spec.y, 200, 50, text, LVGLStyles::COLOR_PRIMARY);
+            TextBindings::bind(binding->owner, lv_obj_get_child(btn, 0), spec.text);
+            setWidgetId(btn, index);
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Set a slot value from outside the page, through the slot handles
+ * (no widget search).
+ */
+void setLayoutValue(const LayoutBinding* binding, uint8_t slot, int32_t value) {
+    if (!binding) return;
+    binding->values[slot] = value;
+    LayoutSlot& handles = binding->slots[slot];
+    if (!handles.widget) return;
+
+    for (uint8_t i = 0; i < binding->count; i++) {
+        const WidgetSpec& spec = binding->specs[i];
+        if (spec.slot != slot) continue;
+        if (spec.kind == WidgetKind::SWITCH) {
+            if (value) lv_obj_add_state(handles.widget, LV_STATE_CHECKED);
+            else lv_obj_clear_state(handles.widget, LV_STATE_CHECKED);
+            return;
+        }
+        if (spec.kind == WidgetKind::SLIDER) {
+            lv_slider_set_value(handles.widget, value, LV_ANIM_OFF);
+            if (handles.valueLabel) {
+                formatFixed(handles.text, sizeof(handles.text), value, spec.format);
+                lv_label_set_text_static(handles.valueLabel, handles.text);
+            }
+            return;
+        }
+    }
+}
+
+void clearLayoutWidgets(const LayoutBinding* binding) {
+    if (!binding) return;
+    for (uint8_t i = 0; i < binding->count; i++) {
+        const WidgetSpec& spec = binding->specs[i];
+        if (spec.kind != WidgetKind::SWITCH && spec.kind != WidgetKind::SLIDER) continue;
+        binding->slots[spec.slot].widget = nullptr;
+        binding->slots[spec.slot].valueLabel = nullptr;
+    }
+}
+
+void buildLayout(lv_obj_t* parent, const LayoutBinding* binding, Text::Language lang) {
+    if (!binding) return;
+    for (uint8_t i = 0; i < binding->count; i++) {
+        buildLayoutItem(parent, binding, i, lang);
+    }
+}
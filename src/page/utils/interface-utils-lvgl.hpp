@@ -19,6 +19,8 @@
 
 #include <lvgl.h>
 #include <Arduino.h>
+#include "../../Translation/text.hpp"
+#include "ValueFormat.hpp"
 
 /**
  * @brief Styles standards pour l'interface
@@ -42,8 +44,121 @@ namespace LVGLStyles {
     extern const lv_font_t* FONT_MEDIUM;   // 20pt
     extern const lv_font_t* FONT_LARGE;    // 24pt
     extern const lv_font_t* FONT_XLARGE;   // 28pt
+
+    static_assert(LV_COLOR_DEPTH == 16, "La palette suppose LV_COLOR_DEPTH 16 (RGB565)");
+
+    /**
+     * @brief Conversion RGB888 -> RGB565 à la compilation
+     */
+    constexpr uint16_t rgb565Raw(uint32_t hex) {
+        return (uint16_t)(((hex >> 8) & 0xF800) | ((hex >> 5) & 0x07E0) | ((hex >> 3) & 0x001F));
+    }
+
+    /**
+     * @brief RGB565 dans l'ordre d'octets attendu par LVGL (LV_COLOR_16_SWAP)
+     */
+    constexpr uint16_t rgb565(uint32_t hex) {
+#if LV_COLOR_16_SWAP
+        return (uint16_t)((rgb565Raw(hex) >> 8) | (rgb565Raw(hex) << 8));
+#else
+        return rgb565Raw(hex);
+#endif
+    }
+
+    static_assert(rgb565Raw(0xFFFFFF) == 0xFFFF && rgb565Raw(0x2196F3) == 0x24BE, "rgb565 conversion");
+
+    // Palette RGB565 calculée à la compilation
+    constexpr uint16_t RGB565_PRIMARY = rgb565(COLOR_PRIMARY);
+    constexpr uint16_t RGB565_SUCCESS = rgb565(COLOR_SUCCESS);
+    constexpr uint16_t RGB565_WARNING = rgb565(COLOR_WARNING);
+    constexpr uint16_t RGB565_DANGER = rgb565(COLOR_DANGER);
+    constexpr uint16_t RGB565_INFO = rgb565(COLOR_INFO);
+    constexpr uint16_t RGB565_BACKGROUND = rgb565(COLOR_BACKGROUND);
+    constexpr uint16_t RGB565_WHITE = rgb565(COLOR_WHITE);
+    constexpr uint16_t RGB565_BLACK = rgb565(COLOR_BLACK);
+    constexpr uint16_t RGB565_TEXT_PRIMARY = rgb565(COLOR_TEXT_PRIMARY);
+    constexpr uint16_t RGB565_TEXT_SECONDARY = rgb565(COLOR_TEXT_SECONDARY);
+
+    /**
+     * @brief Couleur LVGL depuis une couleur hexa, sans lv_color_hex() à l'exécution
+     */
+    inline lv_color_t color(uint32_t hex) {
+        lv_color_t c;
+        c.full = rgb565(hex);
+        return c;
+    }
+
+    /**
+     * @brief Styles partagés du registre (initialisés une seule fois)
+     */
+    enum SharedStyle : uint8_t {
+        CARD,
+        BUTTON,
+        BUTTON_LABEL,
+        ICON_BUTTON,
+        ICON_LABEL,
+        NAVBAR,
+        NAVBAR_TITLE,
+        LIST,
+        LIST_ITEM,
+        SLIDER_INDICATOR,
+        MODAL_OVERLAY,
+        MODAL,
+        TOAST,
+        TOAST_LABEL,
+        SHARED_STYLE_COUNT
+    };
+
+    /**
+     * @brief Retourne un style partagé du registre
+     */
+    lv_style_t* shared(SharedStyle id);
+
+    /**
+     * @brief Style partagé de fond uni (nullptr si la table est pleine)
+     */
+    lv_style_t* background(uint32_t color);
+
+    /**
+     * @brief Style partagé police + couleur de texte (nullptr si la table est pleine)
+     */
+    lv_style_t* text(const lv_font_t* font, uint32_t color);
 }
 
+/**
+ * @brief Applique une couleur de fond via le registre de styles partagés
+ */
+void applyBgColor(lv_obj_t* obj, uint32_t color);
+
+/**
+ * @brief Applique police et couleur de texte via le registre de styles partagés
+ */
+void applyTextStyle(lv_obj_t* obj, const lv_font_t* font, uint32_t color);
+
+/**
+ * @brief Vrai si le texte est en flash (littéraux, tables de Text) et peut
+ * être référencé par un label sans copie
+ */
+bool isStaticText(const char* text);
+
+/**
+ * @brief Texte d'un label : référencé (lv_label_set_text_static) s'il est en
+ * flash, copié dans le tas LVGL sinon
+ */
+void setLabelText(lv_obj_t* label, const char* text);
+
+/**
+ * @brief Compteurs des textes de labels référencés / copiés depuis le démarrage
+ */
+struct LabelTextStats {
+    uint32_t staticLabels;
+    uint32_t staticBytes;
+    uint32_t copiedLabels;
+    uint32_t copiedBytes;
+};
+
+const LabelTextStats& labelTextStats();
+
 /**
  * @brief Crée une carte (container avec fond blanc et ombres)
  */
@@ -79,10 +194,27 @@ lv_obj_t* createSlider(lv_obj_t* parent, int16_t x, int16_t y, lv_coord_t width,
                        int32_t min_value, int32_t max_value, int32_t initial_value);
 
 /**
- * @brief Crée une zone de texte (input)
+ * @brief Préréglage du clavier partagé pour une zone de texte
+ */
+enum class InputMode : uint8_t {
+    TEXT,
+    NUMBER,
+    URL,
+    PASSWORD,
+    COUNT
+};
+
+/**
+ * @brief Identifiants de widget réservés aux zones de texte : le mode de
+ * saisie est encodé dans l'identifiant (WIDGET_INPUT_BASE + mode)
+ */
+constexpr uint8_t WIDGET_INPUT_BASE = 0xF0;
+
+/**
+ * @brief Crée une zone de texte (input), éditée avec le clavier partagé
  */
 lv_obj_t* createTextArea(lv_obj_t* parent, int16_t x, int16_t y, lv_coord_t width, lv_coord_t height,
-                         const char* placeholder = "");
+                         const char* placeholder = "", InputMode mode = InputMode::TEXT);
 
 /**
  * @brief Crée un dropdown (liste déroulante)
@@ -108,23 +240,15 @@ lv_obj_t* createIconButton(lv_obj_t* parent, int16_t x, int16_t y, lv_coord_t si
  */
 lv_obj_t* createNavBar(lv_obj_t* parent, const char* title);
 
-/**
- * @brief Crée une modal (popup)
- */
-lv_obj_t* createModal(lv_obj_t* parent, lv_coord_t width, lv_coord_t height, const char* title);
-
-/**
- * @brief Ferme une modal
- */
-void closeModal(lv_obj_t* modal);
-
 /**
  * @brief Affiche un toast (notification temporaire)
+ * Délègue à Notifications::toast (objet unique réutilisé, file d'attente)
  */
 void showToast(lv_obj_t* parent, const char* message, uint32_t duration_ms = 3000);
 
 /**
- * @brief Crée une liste scrollable
+ * @brief Crée une liste scrollable (un objet par item : pour les listes
+ * longues, utiliser VirtualList)
  */
 lv_obj_t* createScrollableList(lv_obj_t* parent, int16_t x, int16_t y, lv_coord_t width, lv_coord_t height);
 
@@ -137,4 +261,141 @@ void fade_to_screen(lv_obj_t* new_screen, uint16_t time_ms = LVGL_FADE_MS);
  */
 lv_obj_t* addListItem(lv_obj_t* list, const char* text, const char* icon = nullptr);
 
+/**
+ * @brief Délégation d'événements : un seul callback par écran.
+ *
+ * L'identifiant du widget est rangé dans son user_data et le drapeau
+ * LV_OBJ_FLAG_EVENT_BUBBLE est posé sur le widget et ses parents, pour que
+ * ses événements remontent jusqu'à l'écran où la page les répartit.
+ */
+void setWidgetId(lv_obj_t* obj, uint8_t id);
+
+/**
+ * @brief Identifiant posé par setWidgetId, -1 si aucun
+ */
+int widgetId(const lv_obj_t* obj);
+
+/**
+ * @brief Route typée (widget, événement) -> méthode de la page
+ */
+template <class P>
+struct WidgetRoute {
+    uint8_t id;
+    lv_event_code_t code;
+    void (P::*handler)(lv_obj_t* target);
+};
+
+/**
+ * @brief Appelle la méthode correspondant à (id, code) dans la table de routes
+ * @return true si une route a été trouvée
+ */
+template <class P, size_t N>
+bool dispatchWidgetEvent(P* page, const WidgetRoute<P> (&routes)[N], uint8_t id,
+                         lv_event_code_t code, lv_obj_t* target) {
+    for (const WidgetRoute<P>& route : routes) {
+        if (route.id == id && route.code == code) {
+            (page->*route.handler)(target);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Type d'élément d'une mise en page déclarative
+ */
+enum class WidgetKind : uint8_t {
+    TITLE,      // titre centré en haut de la zone
+    SWITCH,     // carte 420x70 : libellé + switch
+    SLIDER,     // carte 420x100 : libellé + valeur formatée + slider
+    BUTTON,     // bouton 200x50
+};
+
+/**
+ * @brief Description constexpr d'un élément de page.
+ *
+ * slot est l'indice de la valeur liée (switch, slider) dans le tableau de
+ * valeurs de la page, ou un identifiant d'action pour un bouton. format donne
+ * l'unité (et les décimales) de la valeur affichée d'un slider.
+ */
+struct WidgetSpec {
+    WidgetKind kind;
+    int16_t x;
+    int16_t y;
+    StrId text;
+    uint8_t slot;
+    int16_t min;
+    int16_t max;
+    ValueFormat format;
+};
+
+/**
+ * @brief Vérifie une table à la compilation : slot de chaque switch ou
+ * slider dans [0, slotCount), min < max
+ */
+template <size_t N>
+constexpr bool layoutIsValid(const WidgetSpec (&specs)[N], uint8_t slotCount) {
+    for (size_t i = 0; i < N; i++) {
+        if (specs[i].kind != WidgetKind::SWITCH && specs[i].kind != WidgetKind::SLIDER) continue;
+        if (specs[i].slot >= slotCount || specs[i].min >= specs[i].max) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Widgets d'un slot, posés par buildLayoutItem et remis à nullptr
+ * par clearLayoutWidgets. text garde le texte de la valeur d'un slider
+ * (référencé par le label, sans copie).
+ */
+struct LayoutSlot {
+    lv_obj_t* widget;       // switch ou slider
+    lv_obj_t* valueLabel;   // valeur affichée d'un slider
+    char text[16];
+};
+
+/**
+ * @brief Liaison entre une table de WidgetSpec et l'état d'une page.
+ *
+ * onChange est appelé après la mise à jour de values[slot] (ou au clic
+ * d'un bouton, avec la valeur 0). slots[slot] garde les widgets et le
+ * texte des sliders : un glissement réécrit ce tampon sans allocation LVGL.
+ */
+struct LayoutBinding {
+    const WidgetSpec* specs;
+    uint8_t count;
+    int32_t* values;
+    LayoutSlot* slots;
+    void* owner;
+    void (*onChange)(void* owner, const WidgetSpec& spec, int32_t value);
+};
+
+/**
+ * @brief Oublie les widgets des slots (à appeler avant de détruire l'écran)
+ */
+void clearLayoutWidgets(const LayoutBinding* binding);
+
+/**
+ * @brief Crée l'élément index d'une mise en page (une étape de build)
+ * Les textes sont liés à TextBindings avec binding->owner (la page).
+ */
+void buildLayoutItem(lv_obj_t* parent, const LayoutBinding* binding, uint8_t index, Text::Language lang);
+
+/**
+ * @brief Crée tous les éléments d'une mise en page
+ */
+void buildLayout(lv_obj_t* parent, const LayoutBinding* binding, Text::Language lang);
+
+/**
+ * @brief Change la valeur d'un slot depuis l'extérieur (état partagé) et
+ * met à jour son widget s'il est construit ; onChange n'est pas appelé
+ */
+void setLayoutValue(const LayoutBinding* binding, uint8_t slot, int32_t value);
+
+/**
+ * @brief Traite un événement délégué venant d'un élément de la mise en page
+ * (l'identifiant du widget est l'indice de son WidgetSpec)
+ * @return true si l'événement concernait la mise en page
+ */
+bool handleLayoutEvent(const LayoutBinding* binding, uint8_t index, lv_event_code_t code, lv_obj_t* target);
+
 #endif
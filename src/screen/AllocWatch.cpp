@@ -0,0 +1,159 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   AllocWatch.cpp                                 :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/19 17:41:05 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/19 17:41:05 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file AllocWatch.cpp
+ * @brief Implementation of the allocation-counting hooks.
+ */
+
+#include "AllocWatch.hpp"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <esp_debug_helpers.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <cstring>
+
+AllocWatch::Site AllocWatch::sites[MAX_SITES] = {};
+uint8_t AllocWatch::siteCount = 0;
+uint32_t AllocWatch::hits = 0;
+uint32_t AllocWatch::bytes = 0;
+uint32_t AllocWatch::dropped = 0;
+void* AllocWatch::task = nullptr;
+volatile bool AllocWatch::watching = false;
+bool AllocWatch::inNote = false;
+
+static const char* const SOURCE_NAMES[AllocWatch::SOURCE_COUNT] = { "malloc", "heap_caps", "lvgl" };
+
+/**
+ * @brief Return address stored on the stack -> address of the call
+ * instruction (windowed ABI keeps the window size in the top bits).
+ */
+static uint32_t callSite(uint32_t pc) {
+    if (pc & 0x80000000) pc = (pc & 0x3fffffff) | 0x40000000;
+    return pc - 3;
+}
+
+void AllocWatch::arm() {
+    watching = false;
+    memset(sites, 0, sizeof(sites));
+    siteCount = 0;
+    hits = 0;
+    bytes = 0;
+    dropped = 0;
+    task = xTaskGetCurrentTaskHandle();
+    watching = true;
+}
+
+uint32_t AllocWatch::disarm() {
+    watching = false;
+    return hits;
+}
+
+void AllocWatch::note(Source source, size_t size) {
+    if (!watching || inNote || xTaskGetCurrentTaskHandle() != task) return;
+    inNote = true;
+    hits++;
+    bytes += size;
+
+    // Skip this function, keep the hook and its callers
+    uint32_t pc[DEPTH] = {};
+    esp_backtrace_frame_t frame = {};
+    esp_backtrace_get_start(&frame.pc, &frame.sp, &frame.next_pc);
+    for (uint8_t depth = 0; depth < DEPTH && frame.next_pc && esp_backtrace_get_next_frame(&frame); depth++) {
+        pc[depth] = callSite(frame.pc);
+    }
+
+    Site* site = nullptr;
+    for (uint8_t i = 0; i < siteCount; i++) {
+        if (sites[i].source == source && memcmp(sites[i].pc, pc, sizeof(pc)) == 0) {
+            site = &sites[i];
+            break;
+        }
+    }
+    if (!site && siteCount < MAX_SITES) {
+        site = &sites[siteCount++];
+        memcpy(site->pc, pc, sizeof(pc));
+        site->source = source;
+    }
+    if (site) {
+        site->count++;
+        site->bytes += size;
+    } else {
+        dropped++;
+    }
+    inNote = false;
+}
+
+void AllocWatch::printSites(Print& out) {
+    out.printf("%lu allocations (%lu bytes) in %u call stacks",
+               (unsigned long)hits, (unsigned long)bytes, (unsigned)siteCount);
+    if (dropped) out.printf(", %lu from other stacks not kept", (unsigned long)dropped);
+    out.printf("\n");
+
+    bool shown[MAX_SITES] = {};
+    for (uint8_t n = 0; n < siteCount; n++) {
+        uint8_t best = MAX_SITES;
+        for (uint8_t i = 0; i < siteCount; i++) {
+            if (!shown[i] && (best == MAX_SITES || sites[i].count > sites[best].count)) best = i;
+        }
+        shown[best] = true;
+        const Site& site = sites[best];
+        out.printf("  %5lu x %-9s %6lu bytes  at", (unsigned long)site.count,
+                   SOURCE_NAMES[site.source], (unsigned long)site.bytes);
+        for (uint8_t d = 0; d < DEPTH && site.pc[d]; d++) out.printf(" 0x%08lx", (unsigned long)site.pc[d]);
+        out.printf("\n");
+    }
+}
+
+#if ALLOC_WATCH_WRAP
+// Linker wraps (-Wl,--wrap=<name>): __real_<name> is the original function
+extern "C" {
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void* __real_heap_caps_malloc(size_t size, uint32_t caps);
+void* __real_heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void* __real_heap_caps_realloc(void* ptr, size_t size, uint32_t caps);
+
+void* __wrap_malloc(size_t size) {
+    AllocWatch::note(AllocWatch::SOURCE_MALLOC, size);
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t n, size_t size) {
+    AllocWatch::note(AllocWatch::SOURCE_MALLOC, n * size);
+    return __real_calloc(n, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    AllocWatch::note(AllocWatch::SOURCE_MALLOC, size);
+    return __real_realloc(ptr, size);
+}
+
+void* __wrap_heap_caps_malloc(size_t size, uint32_t caps) {
+    AllocWatch::note(AllocWatch::SOURCE_HEAP_CAPS, size);
+    return __real_heap_caps_malloc(size, caps);
+}
+
+void* __wrap_heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    AllocWatch::note(AllocWatch::SOURCE_HEAP_CAPS, n * size);
+    return __real_heap_caps_calloc(n, size, caps);
+}
+
+void* __wrap_heap_caps_realloc(void* ptr, size_t size, uint32_t caps) {
+    AllocWatch::note(AllocWatch::SOURCE_HEAP_CAPS, size);
+    return __real_heap_caps_realloc(ptr, size, caps);
+}
+
+}
+#endif // ALLOC_WATCH_WRAP
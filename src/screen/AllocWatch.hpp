@@ -0,0 +1,94 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   AllocWatch.hpp                                 :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/19 17:41:05 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/19 17:41:05 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file AllocWatch.hpp
+ * @brief Counts heap allocations made by one task while armed.
+ *
+ * Hooks:
+ *   malloc / calloc / realloc (and so new, strdup, String...) and
+ *   heap_caps_malloc / calloc / realloc, through the linker
+ *   (-Wl,--wrap=... in the allocwatch env of platformio.ini, which also
+ *   sets ALLOC_WATCH_WRAP; other builds have no wrapper on the heap path)
+ *   the LVGL allocator, from LVGLArena (always)
+ * Only the task that called arm() is counted, so WiFi or USB allocations
+ * on other tasks do not show up. Each distinct call stack is kept with its
+ * count; decode the addresses with
+ *   xtensa-esp32s3-elf-addr2line -pfiaC -e .pio/build/<env>/firmware.elf <pc>...
+ */
+
+#ifndef ALLOC_WATCH_HPP
+#define ALLOC_WATCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/** @brief 1 when the build wraps malloc / heap_caps (allocwatch env) */
+#ifndef ALLOC_WATCH_WRAP
+#define ALLOC_WATCH_WRAP 0
+#endif
+
+class Print;
+
+class AllocWatch {
+public:
+    enum Source : uint8_t {
+        SOURCE_MALLOC = 0,
+        SOURCE_HEAP_CAPS,
+        SOURCE_LVGL,
+        SOURCE_COUNT
+    };
+
+    static constexpr uint8_t DEPTH = 6;
+    static constexpr uint8_t MAX_SITES = 8;
+
+    /**
+     * @brief Clears the counters and starts counting the calling task.
+     */
+    static void arm();
+
+    /**
+     * @brief Stops counting.
+     * @return Allocations seen since arm().
+     */
+    static uint32_t disarm();
+
+    static uint32_t count() { return hits; }
+
+    /**
+     * @brief Hook entry: called before every allocation.
+     */
+    static void note(Source source, size_t size);
+
+    /**
+     * @brief Prints the call stacks seen since arm(), most frequent first.
+     */
+    static void printSites(Print& out);
+
+private:
+    struct Site {
+        uint32_t pc[DEPTH];
+        uint32_t count;
+        uint32_t bytes;
+        Source source;
+    };
+
+    static Site sites[MAX_SITES];
+    static uint8_t siteCount;
+    static uint32_t hits;
+    static uint32_t bytes;
+    static uint32_t dropped;
+    static void* task;
+    static volatile bool watching;
+    static bool inNote;
+};
+
+#endif // ALLOC_WATCH_HPP
@@ -4,6 +4,8 @@
  */
 
 #include "DisplayLVGL.hpp"
+#include "LatencyTracker.hpp"
+#include "MemoryPolicy.hpp"
 
 DisplayLVGL* DisplayLVGL::instance = nullptr;
 
@@ -67,8 +69,8 @@ bool DisplayLVGL::begin() {
     Serial.println("LVGL init OK");
     
     uint32_t bufSize = 480 * 320 / 10;
-    buf1 = (lv_color_t*)heap_caps_malloc(bufSize * sizeof(lv_color_t), MALLOC_CAP_DMA);
-    buf2 = (lv_color_t*)heap_caps_malloc(bufSize * sizeof(lv_color_t), MALLOC_CAP_DMA);
+    buf1 = (lv_color_t*)MemoryPolicy::alloc(MemPool::DMA, bufSize * sizeof(lv_color_t), "draw buffer 1");
+    buf2 = (lv_color_t*)MemoryPolicy::alloc(MemPool::DMA, bufSize * sizeof(lv_color_t), "draw buffer 2");
     
     if (!buf1 || !buf2) {
         Serial.println("LVGL buffer allocation failed!");
@@ -80,6 +82,7 @@ bool DisplayLVGL::begin() {
     disp_drv.hor_res = 480;
     disp_drv.ver_res = 320;
     disp_drv.flush_cb = display_flush;
+    disp_drv.monitor_cb = display_monitor;
     disp_drv.draw_buf = &draw_buf;
     disp_drv.user_data = this;
     disp = lv_disp_drv_register(&disp_drv);
@@ -122,9 +125,21 @@ void DisplayLVGL::display_flush(lv_disp_drv_t* disp_drv, const lv_area_t* area,
     self->canvas->draw16bitRGBBitmap(area->x1, area->y1, (uint16_t*)color_p, w, h);
     self->canvas->flush();
     
+    LatencyTracker::onFlush(micros(), lv_disp_flush_is_last(disp_drv));
     lv_disp_flush_ready(disp_drv);
 }
 
+/**
+ * @brief LVGL monitor callback, called after each refresh cycle.
+ *
+ * @param disp_drv Pointer to the LVGL display driver.
+ * @param time Time spent rendering and flushing, in ms.
+ * @param px Number of refreshed pixels.
+ */
+void DisplayLVGL::display_monitor(lv_disp_drv_t* disp_drv, uint32_t time, uint32_t px) {
+    LatencyTracker::onFrame(time, px);
+}
+
 /**
  * @brief Main loop for LVGL tick and timer handling.
  *
@@ -138,6 +153,7 @@ void DisplayLVGL::loop() {
         lv_tick_inc(diff);
         last = now;
     }
+    LatencyTracker::poll(micros());
     lv_timer_handler();
 }
 
@@ -49,6 +49,7 @@ private:
     static DisplayLVGL* instance;
     
     static void display_flush(lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p);
+    static void display_monitor(lv_disp_drv_t* disp_drv, uint32_t time, uint32_t px);
     
 public:
     DisplayLVGL();
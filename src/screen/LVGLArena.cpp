@@ -0,0 +1,285 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   LVGLArena.cpp                                  :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/19 14:12:40 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/19 14:12:40 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file LVGLArena.cpp
+ * @brief Implementation of the per-page LVGL allocator.
+ */
+
+#include "LVGLArena.hpp"
+#include "MemoryPolicy.hpp"
+#include "AllocWatch.hpp"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <cstring>
+#include "lv_mem_arena.h"
+
+LVGLArena::Heap LVGLArena::fast = {};
+LVGLArena::Heap LVGLArena::shared = {};
+LVGLArena::Heap LVGLArena::pages[MAX_PAGES] = {};
+size_t LVGLArena::pagePeak[MAX_PAGES] = {};
+uint32_t LVGLArena::pageOverflows[MAX_PAGES] = {};
+uint32_t LVGLArena::pageReleases[MAX_PAGES] = {};
+uint32_t LVGLArena::pageLeaks[MAX_PAGES] = {};
+uint32_t LVGLArena::systemFallbacks = 0;
+uint8_t LVGLArena::current = LVGLArena::SHARED;
+bool LVGLArena::ready = false;
+
+// Internal RAM: small blocks are touched on every frame
+static uint8_t fastPool[LVGL_ARENA_FAST_SIZE] __attribute__((aligned(4)));
+
+LVGLArena::Scope::Scope(uint8_t page) : previous(LVGLArena::current) {
+    LVGLArena::current = page < MAX_PAGES ? page : SHARED;
+}
+
+LVGLArena::Scope::~Scope() {
+    LVGLArena::current = previous;
+}
+
+/**
+ * @brief Registers a heap on a region. A null base allocates the region
+ * from the PSRAM pool.
+ */
+bool LVGLArena::reserve(Heap& heap, uint8_t* base, size_t size) {
+    bool owned = !base;
+    if (owned) {
+        base = static_cast<uint8_t*>(MemoryPolicy::alloc(MemPool::PSRAM, size, "LVGL arena"));
+        if (!base) return false;
+    }
+    heap.handle = multi_heap_register(base, size);
+    if (!heap.handle) {
+        if (owned) MemoryPolicy::free(MemPool::PSRAM, base);
+        return false;
+    }
+    heap.base = base;
+    heap.size = size;
+    heap.capacity = multi_heap_free_size(heap.handle);
+    return true;
+}
+
+/**
+ * @brief Sets up the fast and shared heaps. Runs on the first LVGL
+ * allocation (lv_init), before setup() code could call a begin().
+ */
+void LVGLArena::init() {
+    ready = true;
+    if (!reserve(fast, fastPool, sizeof(fastPool))) {
+        Serial.println("[LVGLArena] ERROR: fast pool register failed");
+    }
+    if (!reserve(shared, nullptr, LVGL_ARENA_SHARED_SIZE)) {
+        Serial.println("[LVGLArena] ERROR: shared arena unavailable, using the system heap");
+    }
+}
+
+/**
+ * @brief Finds the heap whose region holds ptr.
+ * @return nullptr for blocks that came from the system heap.
+ */
+LVGLArena::Heap* LVGLArena::owner(void* ptr) {
+    uint8_t* p = static_cast<uint8_t*>(ptr);
+    if (p >= fast.base && p < fast.base + fast.size) return &fast;
+    if (shared.handle && p >= shared.base && p < shared.base + shared.size) return &shared;
+    for (auto& heap : pages) {
+        if (heap.handle && p >= heap.base && p < heap.base + heap.size) return &heap;
+    }
+    return nullptr;
+}
+
+void* LVGLArena::alloc(size_t size) {
+    if (!ready) init();
+    if (size == 0) return nullptr;
+    AllocWatch::note(AllocWatch::SOURCE_LVGL, size);
+
+    void* ptr = nullptr;
+    if (current != SHARED) {
+        Heap& page = pages[current];
+        if (!page.handle && !reserve(page, nullptr, LVGL_ARENA_PAGE_SIZE)) {
+            if (!pageOverflows[current]++) {
+                Serial.printf("[LVGLArena] WARNING: no PSRAM arena for page %u\n", (unsigned)current);
+            }
+        } else {
+            ptr = multi_heap_malloc(page.handle, size);
+            if (ptr) return ptr;
+            if (!pageOverflows[current]++) {
+                Serial.printf("[LVGLArena] WARNING: page %u arena full (%u bytes), spilling to shared\n",
+                              (unsigned)current, (unsigned)page.size);
+            }
+        }
+    } else if (size <= LVGL_ARENA_FAST_MAX && fast.handle) {
+        ptr = multi_heap_malloc(fast.handle, size);
+        if (ptr) return ptr;
+    }
+
+    if (shared.handle) {
+        ptr = multi_heap_malloc(shared.handle, size);
+        if (ptr) return ptr;
+    }
+    systemFallbacks++;
+    return heap_caps_malloc(size, MALLOC_CAP_8BIT);
+}
+
+void LVGLArena::free(void* ptr) {
+    if (!ptr) return;
+    Heap* heap = owner(ptr);
+    if (heap) multi_heap_free(heap->handle, ptr);
+    else heap_caps_free(ptr);
+}
+
+/**
+ * @brief Grows a block in its own heap, or moves it. A moved block keeps
+ * its owner, not the current scope: LVGL-global arrays (disp->screens,
+ * grown by every lv_obj_create(NULL) inside a page scope) stay in the
+ * shared heaps, page blocks stay in their page arena. Fast blocks that
+ * outgrow LVGL_ARENA_FAST_MAX always move (to the shared arena).
+ */
+void* LVGLArena::realloc(void* ptr, size_t size) {
+    if (!ptr) return alloc(size);
+    if (size == 0) {
+        free(ptr);
+        return nullptr;
+    }
+
+    AllocWatch::note(AllocWatch::SOURCE_LVGL, size);
+    Heap* heap = owner(ptr);
+    if (!heap) return heap_caps_realloc(ptr, size, MALLOC_CAP_8BIT);
+    if (heap != &fast || size <= LVGL_ARENA_FAST_MAX) {
+        void* grown = multi_heap_realloc(heap->handle, ptr, size);
+        if (grown) return grown;
+    }
+
+    bool pageBlock = heap >= pages && heap < pages + MAX_PAGES;
+    void* moved;
+    {
+        Scope keep(pageBlock ? static_cast<uint8_t>(heap - pages) : SHARED);
+        moved = alloc(size);
+    }
+    if (!moved) return nullptr;
+    size_t old = multi_heap_get_allocated_size(heap->handle, ptr);
+    memcpy(moved, ptr, old < size ? old : size);
+    multi_heap_free(heap->handle, ptr);
+    return moved;
+}
+
+void LVGLArena::notePeak(uint8_t page) {
+    Heap& heap = pages[page];
+    if (!heap.handle) return;
+    multi_heap_info_t info;
+    multi_heap_get_info(heap.handle, &info);
+    size_t peak = heap.capacity - info.minimum_free_bytes;
+    if (peak > pagePeak[page]) pagePeak[page] = peak;
+}
+
+bool LVGLArena::release(uint8_t page) {
+    if (page >= MAX_PAGES || !pages[page].handle) return true;
+    Heap& heap = pages[page];
+    notePeak(page);
+
+    multi_heap_info_t info;
+    multi_heap_get_info(heap.handle, &info);
+    if (info.allocated_blocks) {
+        pageLeaks[page]++;
+        Serial.printf("[LVGLArena] WARNING: page %u deleted with %u blocks (%u bytes) left, arena kept\n",
+                      (unsigned)page, (unsigned)info.allocated_blocks,
+                      (unsigned)info.total_allocated_bytes);
+        return false;
+    }
+
+    MemoryPolicy::free(MemPool::PSRAM, heap.base);
+    heap = Heap{};
+    pageReleases[page]++;
+    return true;
+}
+
+size_t LVGLArena::pageUsed(uint8_t page) {
+    if (page >= MAX_PAGES || !pages[page].handle) return 0;
+    return pages[page].capacity - multi_heap_free_size(pages[page].handle);
+}
+
+void LVGLArena::monitor(lv_mem_monitor_t* mon) {
+    memset(mon, 0, sizeof(*mon));
+    if (!ready) init();
+
+    size_t minFree = 0;
+    auto add = [&](const Heap& heap) {
+        if (!heap.handle) return;
+        multi_heap_info_t info;
+        multi_heap_get_info(heap.handle, &info);
+        mon->total_size += heap.capacity;
+        mon->free_size += info.total_free_bytes;
+        mon->free_cnt += info.free_blocks;
+        mon->used_cnt += info.allocated_blocks;
+        minFree += info.minimum_free_bytes;
+        if (info.largest_free_block > mon->free_biggest_size) mon->free_biggest_size = info.largest_free_block;
+    };
+    add(fast);
+    add(shared);
+    for (const auto& heap : pages) add(heap);
+
+    mon->max_used = mon->total_size - minFree;
+    if (mon->total_size) mon->used_pct = 100 - (100U * mon->free_size) / mon->total_size;
+    if (mon->free_size) mon->frag_pct = 100 - (100U * mon->free_biggest_size) / mon->free_size;
+}
+
+/**
+ * @brief Prints one line per heap: used, high-water mark, largest free
+ * block and fragmentation (share of free memory not in the largest block).
+ */
+void LVGLArena::printReport(Print& out) {
+    if (!ready) init();
+
+    auto line = [&out](const char* name, const Heap& heap, size_t peak) {
+        multi_heap_info_t info;
+        multi_heap_get_info(heap.handle, &info);
+        size_t used = heap.capacity - info.total_free_bytes;
+        size_t low = heap.capacity - info.minimum_free_bytes;
+        unsigned frag = info.total_free_bytes
+            ? 100 - (unsigned)((100ULL * info.largest_free_block) / info.total_free_bytes) : 0;
+        out.printf("  %-8s %6u / %6u  peak %6u  blocks %4u  biggest free %6u  frag %3u%%\n",
+                   name, (unsigned)used, (unsigned)heap.capacity, (unsigned)(peak > low ? peak : low),
+                   (unsigned)info.allocated_blocks, (unsigned)info.largest_free_block, frag);
+    };
+
+    out.printf("=== LVGL arenas ===\n");
+    if (fast.handle) line("fast", fast, 0);
+    if (shared.handle) line("shared", shared, 0);
+    char name[12];
+    for (uint8_t i = 0; i < MAX_PAGES; i++) {
+        if (pages[i].handle) {
+            snprintf(name, sizeof(name), "page %u", (unsigned)i);
+            line(name, pages[i], pagePeak[i]);
+        } else if (pagePeak[i]) {
+            out.printf("  page %-3u released, peak %6u\n", (unsigned)i, (unsigned)pagePeak[i]);
+        }
+        if (pageOverflows[i] || pageLeaks[i] || pageReleases[i]) {
+            out.printf("           releases %lu  spills %lu  leaks %lu\n",
+                       (unsigned long)pageReleases[i], (unsigned long)pageOverflows[i],
+                       (unsigned long)pageLeaks[i]);
+        }
+    }
+    out.printf("system heap fallbacks %lu\n", (unsigned long)systemFallbacks);
+}
+
+// LVGL entry points (LV_MEM_CUSTOM_ALLOC / FREE / REALLOC in lv_conf.h)
+extern "C" {
+
+void* lv_arena_alloc(size_t size) {
+    return LVGLArena::alloc(size);
+}
+
+void lv_arena_free(void* ptr) {
+    LVGLArena::free(ptr);
+}
+
+void* lv_arena_realloc(void* ptr, size_t size) {
+    return LVGLArena::realloc(ptr, size);
+}
+
+}
@@ -0,0 +1,127 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   LVGLArena.hpp                                  :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/19 14:12:40 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/19 14:12:40 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file LVGLArena.hpp
+ * @brief LVGL allocator (LV_MEM_CUSTOM) with one PSRAM arena per page.
+ *
+ * Every LVGL allocation lands in one of three kinds of heaps:
+ *   page arena  allocations made while a page is being built (Scope), in a
+ *               PSRAM region reserved for that page on first use
+ *   fast        small blocks (<= LVGL_ARENA_FAST_MAX) made outside any page
+ *               build: timers, animations, draw masks, runtime text copies.
+ *               They are allocated and freed every frame, so they stay in
+ *               internal RAM
+ *   shared      everything else outside a page build: shared styles, layer
+ *               top widgets, large draw buffers (PSRAM)
+ * Regions come from the MemoryPolicy PSRAM pool.
+ * Frees and reallocs find the owning heap from the address. Once a page is
+ * deleted its arena is empty and the whole region goes back to the system
+ * in one free, so page trees can not fragment each other.
+ * A page arena that runs full spills into the shared arena (counted).
+ */
+
+#ifndef LVGL_ARENA_HPP
+#define LVGL_ARENA_HPP
+
+#include <lvgl.h>
+#include <multi_heap.h>
+#include <cstddef>
+#include <cstdint>
+
+/** @brief PSRAM reserved for one page tree (override with -DLVGL_ARENA_PAGE_SIZE=...). */
+#ifndef LVGL_ARENA_PAGE_SIZE
+#define LVGL_ARENA_PAGE_SIZE (32 * 1024)
+#endif
+
+/** @brief PSRAM arena for allocations not owned by a page. */
+#ifndef LVGL_ARENA_SHARED_SIZE
+#define LVGL_ARENA_SHARED_SIZE (64 * 1024)
+#endif
+
+/** @brief Internal RAM pool for small runtime blocks, and the largest block it takes. */
+#ifndef LVGL_ARENA_FAST_SIZE
+#define LVGL_ARENA_FAST_SIZE (16 * 1024)
+#endif
+#ifndef LVGL_ARENA_FAST_MAX
+#define LVGL_ARENA_FAST_MAX 64
+#endif
+
+class Print;
+
+class LVGLArena {
+public:
+    static constexpr uint8_t MAX_PAGES = 24;
+    static constexpr uint8_t SHARED = 0xFF;
+
+    /**
+     * @brief Routes the LVGL allocations of its lifetime to a page arena
+     * (or to the shared heaps with SHARED). Scopes nest.
+     */
+    class Scope {
+    public:
+        explicit Scope(uint8_t page);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        uint8_t previous;
+    };
+
+    static void* alloc(size_t size);
+    static void free(void* ptr);
+    static void* realloc(void* ptr, size_t size);
+
+    /**
+     * @brief Gives an empty page arena back to the system.
+     * Call after the page tree was deleted.
+     * @return False if blocks are still allocated in it (leak, arena kept).
+     */
+    static bool release(uint8_t page);
+
+    /**
+     * @brief Fills an lv_mem_monitor_t for all heaps together
+     * (lv_mem_monitor() reports nothing with LV_MEM_CUSTOM).
+     * Reserved page arenas count with their size, unreserved ones do not.
+     */
+    static void monitor(lv_mem_monitor_t* mon);
+
+    static size_t pageUsed(uint8_t page);
+
+    static void printReport(Print& out);
+
+private:
+    struct Heap {
+        uint8_t* base;
+        size_t size;
+        multi_heap_handle_t handle;
+        size_t capacity;        // free bytes right after register (size minus heap overhead)
+    };
+
+    static Heap fast;
+    static Heap shared;
+    static Heap pages[MAX_PAGES];
+    static size_t pagePeak[MAX_PAGES];
+    static uint32_t pageOverflows[MAX_PAGES];
+    static uint32_t pageReleases[MAX_PAGES];
+    static uint32_t pageLeaks[MAX_PAGES];
+    static uint32_t systemFallbacks;
+    static uint8_t current;
+    static bool ready;
+
+    static void init();
+    static bool reserve(Heap& heap, uint8_t* base, size_t size);
+    static Heap* owner(void* ptr);
+    static void notePeak(uint8_t page);
+};
+
+#endif // LVGL_ARENA_HPP
@@ -15,11 +15,13 @@
  */
 
 #include "LVGLTouchInput.hpp"
+#include "LatencyTracker.hpp"
+#include "MemoryPolicy.hpp"
 
 LVGLTouchInput* LVGLTouchInput::instance = nullptr;
 
 LVGLTouchInput::LVGLTouchInput(TouchController* touch)
-    : touch(touch), indev(nullptr) {
+    : touch(touch), indev(nullptr), wasPressed(false), dispatchPending(false), recording(false) {
     instance = this;
 }
 
@@ -31,6 +33,7 @@ bool LVGLTouchInput::begin() {
     lv_indev_drv_init(&indev_drv);
     indev_drv.type = LV_INDEV_TYPE_POINTER;
     indev_drv.read_cb = read_touch;
+    indev_drv.feedback_cb = on_feedback;
     indev_drv.user_data = this;
 
     indev = lv_indev_drv_register(&indev_drv);
@@ -38,6 +41,8 @@ bool LVGLTouchInput::begin() {
         Serial.println("LVGL touch registration failed!");
         return false;
     }
+    // Wrap LVGL's read timer to stamp dispatch once the page callbacks returned
+    lv_timer_set_cb(indev_drv.read_timer, on_read_timer);
 
     Serial.println("LVGL touch initialized!");
     return true;
@@ -45,8 +50,32 @@ bool LVGLTouchInput::begin() {
 
 void LVGLTouchInput::read_touch(lv_indev_drv_t* drv, lv_indev_data_t* data) {
     LVGLTouchInput* self = static_cast<LVGLTouchInput*>(drv->user_data);
-    uint16_t x, y;
-    bool touched = self->touch->getTouchPoint(x, y);
+    uint16_t x = 0, y = 0;
+    bool touched;
+
+    if (self->player.isPlaying()) {
+        TouchTrace::Sample sample;
+        if (!self->player.read(millis(), sample)) {
+            Serial.println("[LVGL Touch] Replay finished");
+            LatencyTracker::printReport(Serial);
+        }
+        x = sample.x;
+        y = sample.y;
+        touched = sample.pressed;
+    } else {
+        touched = self->touch->getTouchPoint(x, y);
+        if (self->recording && !self->trace.append(millis(), {x, y, touched})) {
+            self->recording = false;
+            Serial.println("[LVGL Touch] Trace full, recording stopped");
+        }
+    }
+
+    if (touched != self->wasPressed) {
+        uint32_t now = micros();
+        bool live = !self->player.isPlaying();
+        LatencyTracker::onTouchEdge(touched && live ? self->touch->getLastSampleTime() : now, now);
+        self->wasPressed = touched;
+    }
 
     if (touched) {
         data->state = LV_INDEV_STATE_PR;
@@ -62,3 +91,108 @@ void LVGLTouchInput::read_touch(lv_indev_drv_t* drv, lv_indev_data_t* data) {
         data->state = LV_INDEV_STATE_REL;
     }
 }
+
+/**
+ * @brief Called by LVGL before the object callbacks run, and again at each
+ * bubble level: it only notes that an input event is being dispatched.
+ */
+void LVGLTouchInput::on_feedback(lv_indev_drv_t* drv, uint8_t code) {
+    if (code == LV_EVENT_PRESSED || code == LV_EVENT_RELEASED || code == LV_EVENT_CLICKED) {
+        static_cast<LVGLTouchInput*>(drv->user_data)->dispatchPending = true;
+    }
+}
+
+/**
+ * @brief LVGL's indev read, then one dispatch stamp if it sent an input
+ * event: every page callback of that read has returned by now (RELEASED
+ * and CLICKED of the same edge share the stamp).
+ */
+void LVGLTouchInput::on_read_timer(lv_timer_t* timer) {
+    lv_indev_read_timer_cb(timer);
+    LVGLTouchInput* self = instance;
+    if (self && self->dispatchPending) {
+        self->dispatchPending = false;
+        LatencyTracker::onDispatch(micros());
+    }
+}
+
+bool LVGLTouchInput::ensureTraceStorage() {
+    if (trace.data()) return true;
+    uint32_t* storage = (uint32_t*)MemoryPolicy::alloc(MemPool::PSRAM, TRACE_CAPACITY * sizeof(uint32_t), "touch trace");
+    if (!storage) {
+        Serial.println("[LVGL Touch] ERROR: trace buffer allocation failed");
+        return false;
+    }
+    trace.attach(storage, TRACE_CAPACITY);
+    return true;
+}
+
+void LVGLTouchInput::startRecording() {
+    if (!ensureTraceStorage()) return;
+    player.stop();
+    trace.clear();
+    recording = true;
+    Serial.println("[LVGL Touch] Recording started");
+}
+
+void LVGLTouchInput::stopRecording() {
+    recording = false;
+    Serial.printf("[LVGL Touch] Recording stopped: %u records, %lu ms\n",
+                  (unsigned)trace.size(), (unsigned long)trace.durationMs());
+}
+
+void LVGLTouchInput::startReplay(uint16_t speedPercent) {
+    recording = false;
+    if (!trace.size()) {
+        Serial.println("[LVGL Touch] No trace to replay");
+        return;
+    }
+    LatencyTracker::reset();
+    player.start(&trace, millis(), speedPercent);
+    Serial.printf("[LVGL Touch] Replay started: %u records at %u%%\n", (unsigned)trace.size(), speedPercent);
+}
+
+/**
+ * @brief Print the trace as hex text: "TRACE <count>", 8 records per line, "END".
+ */
+void LVGLTouchInput::dumpTrace(Print& out) const {
+    out.printf("TRACE %u\n", (unsigned)trace.size());
+    for (size_t i = 0; i < trace.size(); i++) {
+        out.printf("%08lx", (unsigned long)trace.data()[i]);
+        if (i % 8 == 7 || i + 1 == trace.size()) out.println();
+    }
+    out.println("END");
+}
+
+/**
+ * @brief Read a trace in the dumpTrace() format.
+ */
+bool LVGLTouchInput::loadTrace(Stream& in) {
+    if (!ensureTraceStorage()) return false;
+    recording = false;
+    player.stop();
+    trace.clear();
+
+    char line[80];
+    size_t expected = 0;
+    size_t n = 0;
+    while (true) {
+        size_t len = in.readBytesUntil('\n', line, sizeof(line) - 1);
+        if (len == 0) break;
+        line[len] = '\0';
+        if (strncmp(line, "TRACE ", 6) == 0) {
+            expected = strtoul(line + 6, nullptr, 10);
+            continue;
+        }
+        if (strncmp(line, "END", 3) == 0) break;
+        for (size_t pos = 0; pos + 8 <= len && n < trace.capacity(); pos += 8) {
+            char word[9];
+            memcpy(word, line + pos, 8);
+            word[8] = '\0';
+            trace.data()[n++] = strtoul(word, nullptr, 16);
+        }
+    }
+    trace.setSize(n);
+    Serial.printf("[LVGL Touch] Loaded %u/%u records\n", (unsigned)n, (unsigned)expected);
+    return n > 0 && n == expected;
+}
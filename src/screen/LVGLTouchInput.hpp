@@ -20,15 +20,27 @@
 #include <Arduino.h>
 #include <lvgl.h>
 #include "TouchController.hpp"
+#include "TouchTrace.hpp"
 
 class LVGLTouchInput {
 private:
     TouchController* touch;
     lv_indev_drv_t indev_drv;
     lv_indev_t* indev;
+    bool wasPressed;
+    bool dispatchPending;
+
+    static constexpr size_t TRACE_CAPACITY = 16384; // 64 KB in PSRAM
+    TouchTrace trace;
+    TouchTracePlayer player;
+    bool recording;
+
+    bool ensureTraceStorage();
 
     static LVGLTouchInput* instance;
     static void read_touch(lv_indev_drv_t* drv, lv_indev_data_t* data);
+    static void on_feedback(lv_indev_drv_t* drv, uint8_t code);
+    static void on_read_timer(lv_timer_t* timer);
 
 public:
     explicit LVGLTouchInput(TouchController* touch);
@@ -36,6 +48,17 @@ public:
 
     bool begin();
 
+    TouchController* getTouchController() const { return touch; }
+
+    // Trace record / replay (see TouchTrace.hpp)
+    void startRecording();
+    void stopRecording();
+    bool isRecording() const { return recording; }
+    void startReplay(uint16_t speedPercent = 100);
+    bool isReplaying() const { return player.isPlaying(); }
+    void dumpTrace(Print& out) const;
+    bool loadTrace(Stream& in);
+
     static LVGLTouchInput* getInstance() { return instance; }
 };
 
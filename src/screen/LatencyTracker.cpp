@@ -0,0 +1,171 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   LatencyTracker.cpp                             :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 11:05:27 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 11:05:27 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file LatencyTracker.cpp
+ * @brief Implementation of touch-to-photon latency instrumentation.
+ */
+
+#include "LatencyTracker.hpp"
+#include <lvgl.h>
+
+uint32_t LatencyTracker::stamps[STAGE_COUNT] = {};
+uint8_t LatencyTracker::reached = 0;
+uint8_t LatencyTracker::measurePage = 0;
+uint8_t LatencyTracker::currentPage = 0;
+bool LatencyTracker::active = false;
+uint32_t LatencyTracker::dropped = 0;
+LatencyTracker::Histogram LatencyTracker::totals[MAX_PAGES];
+LatencyTracker::Histogram LatencyTracker::stages[STAGE_COUNT];
+LatencyTracker::Histogram LatencyTracker::frames;
+uint64_t LatencyTracker::framePixels = 0;
+
+static const char* const stageNames[] = {"touch", "read", "dispatch", "invalidate", "flush"};
+
+uint8_t LatencyTracker::Histogram::bucketOf(uint32_t us) {
+    if (us < (1UL << MIN_LOG2)) return 0;
+    uint8_t log2 = 31 - __builtin_clz(us);
+    if (log2 >= MAX_LOG2) return BUCKETS - 1;
+    uint8_t sub = (us >> (log2 - 2)) & (SUB_BUCKETS - 1);
+    return 1 + (log2 - MIN_LOG2) * SUB_BUCKETS + sub;
+}
+
+uint32_t LatencyTracker::Histogram::bucketValue(uint8_t bucket) {
+    if (bucket == 0) return (1UL << MIN_LOG2) / 2;
+    if (bucket >= BUCKETS - 1) return 1UL << MAX_LOG2;
+    uint8_t log2 = MIN_LOG2 + (bucket - 1) / SUB_BUCKETS;
+    uint8_t sub = (bucket - 1) % SUB_BUCKETS;
+    uint32_t low = (1UL << log2) + sub * (1UL << (log2 - 2));
+    return low + (1UL << (log2 - 3)); // middle of the bucket
+}
+
+void LatencyTracker::Histogram::add(uint32_t us) {
+    uint8_t b = bucketOf(us);
+    if (counts[b] < UINT16_MAX) counts[b]++;
+    total++;
+    if (us > maxUs) maxUs = us;
+}
+
+uint32_t LatencyTracker::Histogram::percentile(uint8_t pct) const {
+    if (total == 0) return 0;
+    uint32_t sum = 0;
+    for (uint8_t b = 0; b < BUCKETS; b++) sum += counts[b];
+    uint32_t rank = (sum * pct + 99) / 100;
+    uint32_t seen = 0;
+    for (uint8_t b = 0; b < BUCKETS; b++) {
+        seen += counts[b];
+        if (seen >= rank && counts[b]) return bucketValue(b);
+    }
+    return maxUs;
+}
+
+void LatencyTracker::Histogram::reset() {
+    for (auto& c : counts) c = 0;
+    total = 0;
+    maxUs = 0;
+}
+
+bool LatencyTracker::invalidationPending() {
+    lv_disp_t* disp = lv_disp_get_default();
+    return disp && disp->inv_p > 0;
+}
+
+void LatencyTracker::onTouchEdge(uint32_t touchUs, uint32_t readUs) {
+    if (active) dropped++;
+    active = true;
+    measurePage = currentPage;
+    stamps[STAGE_TOUCH] = touchUs;
+    stamps[STAGE_READ] = readUs;
+    reached = STAGE_READ;
+}
+
+void LatencyTracker::onDispatch(uint32_t nowUs) {
+    if (!active) return;
+    stamps[STAGE_DISPATCH] = nowUs;
+    reached = STAGE_DISPATCH;
+    if (invalidationPending()) {
+        stamps[STAGE_INVALIDATE] = nowUs;
+        reached = STAGE_INVALIDATE;
+    }
+}
+
+void LatencyTracker::poll(uint32_t nowUs) {
+    if (!active) return;
+    if (nowUs - stamps[STAGE_READ] > TIMEOUT_US) {
+        // Nothing on screen changed for this edge
+        active = false;
+        return;
+    }
+    if (reached == STAGE_DISPATCH && invalidationPending()) {
+        stamps[STAGE_INVALIDATE] = nowUs;
+        reached = STAGE_INVALIDATE;
+    }
+}
+
+void LatencyTracker::onFlush(uint32_t nowUs, bool isLast) {
+    if (!active || reached < STAGE_DISPATCH) return;
+    if (reached == STAGE_DISPATCH) {
+        // Invalidated and rendered within the same timer pass
+        stamps[STAGE_INVALIDATE] = nowUs;
+        reached = STAGE_INVALIDATE;
+    }
+    if (!isLast) return;
+    stamps[STAGE_FLUSH] = nowUs;
+    reached = STAGE_FLUSH;
+    complete();
+}
+
+void LatencyTracker::onFrame(uint32_t renderMs, uint32_t pixels) {
+    frames.add(renderMs * 1000);
+    framePixels += pixels;
+}
+
+void LatencyTracker::complete() {
+    active = false;
+    totals[measurePage].add(stamps[STAGE_FLUSH] - stamps[STAGE_TOUCH]);
+    for (uint8_t s = STAGE_READ; s < STAGE_COUNT; s++) {
+        stages[s].add(stamps[s] - stamps[s - 1]);
+    }
+}
+
+void LatencyTracker::printReport(Print& out) {
+    out.println("=== Touch-to-photon latency (us) ===");
+    out.println("page   count      p50      p95      p99      max");
+    for (uint8_t p = 0; p < MAX_PAGES; p++) {
+        const Histogram& h = totals[p];
+        if (!h.count()) continue;
+        out.printf("%4u %7lu %8lu %8lu %8lu %8lu\n", p, (unsigned long)h.count(),
+                   (unsigned long)h.percentile(50), (unsigned long)h.percentile(95),
+                   (unsigned long)h.percentile(99), (unsigned long)h.max());
+    }
+    out.println("stage            p50      p95      p99");
+    for (uint8_t s = STAGE_READ; s < STAGE_COUNT; s++) {
+        const Histogram& h = stages[s];
+        out.printf("%-5s->%-10s %8lu %8lu %8lu\n", stageNames[s - 1], stageNames[s],
+                   (unsigned long)h.percentile(50), (unsigned long)h.percentile(95),
+                   (unsigned long)h.percentile(99));
+    }
+    out.printf("frames %lu  render p50 %lu  p95 %lu  p99 %lu  max %lu  avg px %lu\n",
+               (unsigned long)frames.count(), (unsigned long)frames.percentile(50),
+               (unsigned long)frames.percentile(95), (unsigned long)frames.percentile(99),
+               (unsigned long)frames.max(),
+               (unsigned long)(frames.count() ? framePixels / frames.count() : 0));
+    out.printf("dropped (overlapping edges): %lu\n", (unsigned long)dropped);
+}
+
+void LatencyTracker::reset() {
+    for (auto& h : totals) h.reset();
+    for (auto& h : stages) h.reset();
+    frames.reset();
+    framePixels = 0;
+    dropped = 0;
+    active = false;
+}
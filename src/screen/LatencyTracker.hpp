@@ -0,0 +1,107 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   LatencyTracker.hpp                             :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 11:05:27 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 11:05:27 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file LatencyTracker.hpp
+ * @brief Touch-to-photon latency instrumentation.
+ *
+ * Each touch edge (press or release) opens a measurement that is stamped at
+ * every stage of the chain:
+ *   TOUCH     controller IRQ (or poll when no IRQ was seen) in TouchController
+ *   READ      indev read in LVGLTouchInput::read_touch
+ *   DISPATCH  the page callbacks for the events of the edge returned (end of the indev read)
+ *   INVALIDATE first time an invalidated area is pending afterwards
+ *   FLUSH     last area of the resulting frame left DisplayLVGL::display_flush
+ * Edges that produce no redraw are dropped. Totals are kept in log-scaled
+ * histograms per page, stage deltas in global ones. Render time of every
+ * refresh is kept as well so replays of the same trace can be compared.
+ */
+
+#ifndef LATENCY_TRACKER_HPP
+#define LATENCY_TRACKER_HPP
+
+#include <Arduino.h>
+
+class LatencyTracker {
+public:
+    enum Stage : uint8_t {
+        STAGE_TOUCH = 0,
+        STAGE_READ,
+        STAGE_DISPATCH,
+        STAGE_INVALIDATE,
+        STAGE_FLUSH,
+        STAGE_COUNT
+    };
+
+    /**
+     * @brief Log-scaled histogram in microseconds (4 buckets per power of two, 256us..4s).
+     */
+    class Histogram {
+    public:
+        void add(uint32_t us);
+        uint32_t percentile(uint8_t pct) const;
+        uint32_t count() const { return total; }
+        uint32_t max() const { return maxUs; }
+        void reset();
+
+    private:
+        static constexpr uint8_t MIN_LOG2 = 8;
+        static constexpr uint8_t MAX_LOG2 = 22;
+        static constexpr uint8_t SUB_BUCKETS = 4;
+        static constexpr uint8_t BUCKETS = (MAX_LOG2 - MIN_LOG2) * SUB_BUCKETS + 2;
+
+        static uint8_t bucketOf(uint32_t us);
+        static uint32_t bucketValue(uint8_t bucket);
+
+        uint16_t counts[BUCKETS] = {};
+        uint32_t total = 0;
+        uint32_t maxUs = 0;
+    };
+
+    static constexpr uint8_t MAX_PAGES = 24;
+
+    /** @brief Page the next measurements are attributed to (called by PageManager). */
+    static void setPage(uint8_t pageId) { currentPage = pageId < MAX_PAGES ? pageId : 0; }
+
+    /** @brief A touch edge was read by the indev; touchUs is the IRQ/poll time. */
+    static void onTouchEdge(uint32_t touchUs, uint32_t readUs);
+    /** @brief The page callbacks of an indev event returned (once per indev read). */
+    static void onDispatch(uint32_t nowUs);
+    /** @brief Called from the display loop to notice invalidations made outside dispatch. */
+    static void poll(uint32_t nowUs);
+    /** @brief A flush finished; isLast is true for the last area of a frame. */
+    static void onFlush(uint32_t nowUs, bool isLast);
+    /** @brief A refresh cycle finished (display monitor callback). */
+    static void onFrame(uint32_t renderMs, uint32_t pixels);
+
+    static void printReport(Print& out);
+    static void reset();
+
+private:
+    static constexpr uint32_t TIMEOUT_US = 500000;
+
+    static uint32_t stamps[STAGE_COUNT];
+    static uint8_t reached;
+    static uint8_t measurePage;
+    static uint8_t currentPage;
+    static bool active;
+    static uint32_t dropped;
+
+    static Histogram totals[MAX_PAGES];
+    static Histogram stages[STAGE_COUNT];
+    static Histogram frames;
+    static uint64_t framePixels;
+
+    static bool invalidationPending();
+    static void complete();
+};
+
+#endif // LATENCY_TRACKER_HPP
@@ -0,0 +1,167 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   MemoryPolicy.cpp                               :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/19 16:03:18 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/19 16:03:18 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file MemoryPolicy.cpp
+ * @brief Implementation of the heap placement policy and telemetry.
+ */
+
+#include "MemoryPolicy.hpp"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+
+MemoryPolicy::Stats MemoryPolicy::stats[static_cast<uint8_t>(MemPool::COUNT)] = {};
+uint32_t MemoryPolicy::systemFailures = 0;
+size_t MemoryPolicy::lastFailedSize = 0;
+uint32_t MemoryPolicy::lastFailedCaps = 0;
+uint32_t MemoryPolicy::lastReport = 0;
+
+namespace {
+
+struct PoolInfo {
+    const char* name;
+    uint32_t caps;
+    size_t lowBlock;    // largest free block below this: heading for a failure
+};
+
+constexpr PoolInfo poolInfo[] = {
+    { "dma",      MALLOC_CAP_DMA,                          8 * 1024 },
+    { "internal", MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,  16 * 1024 },
+    { "psram",    MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT,   256 * 1024 },
+};
+
+static_assert(sizeof(poolInfo) / sizeof(poolInfo[0]) == static_cast<uint8_t>(MemPool::COUNT),
+              "one entry per pool");
+
+const PoolInfo& info(MemPool pool) {
+    return poolInfo[static_cast<uint8_t>(pool)];
+}
+
+} // namespace
+
+uint32_t MemoryPolicy::caps(MemPool pool) {
+    return info(pool).caps;
+}
+
+const char* MemoryPolicy::name(MemPool pool) {
+    return pool < MemPool::COUNT ? info(pool).name : "?";
+}
+
+void MemoryPolicy::begin() {
+    heap_caps_register_failed_alloc_callback(on_alloc_failed);
+    lastReport = millis();
+}
+
+/**
+ * @brief ESP-IDF hook: runs for every failed heap_caps/malloc call,
+ * including the ones that do not go through this layer.
+ */
+void MemoryPolicy::on_alloc_failed(size_t size, uint32_t caps, const char* function) {
+    // No Serial here: the hook may run inside the allocator
+    systemFailures++;
+    lastFailedSize = size;
+    lastFailedCaps = caps;
+}
+
+void* MemoryPolicy::alloc(MemPool pool, size_t size, const char* tag) {
+    if (pool >= MemPool::COUNT || size == 0) return nullptr;
+    Stats& s = stats[static_cast<uint8_t>(pool)];
+
+    void* ptr = heap_caps_malloc(size, caps(pool));
+    if (!ptr && pool == MemPool::PSRAM
+        && heap_caps_get_free_size(caps(MemPool::INTERNAL)) > size + MEMORY_INTERNAL_RESERVE) {
+        ptr = heap_caps_malloc(size, caps(MemPool::INTERNAL));
+        if (ptr) s.fallbacks++;
+    }
+    if (!ptr) {
+        s.failures++;
+        Serial.printf("[MemoryPolicy] ERROR: %s: %u bytes from %s failed (largest free %u)\n",
+                      tag ? tag : "?", (unsigned)size, name(pool),
+                      (unsigned)heap_caps_get_largest_free_block(caps(pool)));
+        return nullptr;
+    }
+
+    s.bytes += heap_caps_get_allocated_size(ptr);
+    s.blocks++;
+    if (s.bytes > s.peak) s.peak = s.bytes;
+    return ptr;
+}
+
+void MemoryPolicy::free(MemPool pool, void* ptr) {
+    if (!ptr || pool >= MemPool::COUNT) return;
+    Stats& s = stats[static_cast<uint8_t>(pool)];
+    size_t size = heap_caps_get_allocated_size(ptr);
+    s.bytes = s.bytes > size ? s.bytes - size : 0;
+    if (s.blocks) s.blocks--;
+    heap_caps_free(ptr);
+}
+
+bool MemoryPolicy::isLow(MemPool pool) {
+    if (pool >= MemPool::COUNT) return false;
+    if (!heap_caps_get_total_size(caps(pool))) return false;
+    return heap_caps_get_largest_free_block(caps(pool)) < info(pool).lowBlock;
+}
+
+/**
+ * @brief Fragmentation in percent: share of the free memory that is not
+ * in the largest free block.
+ */
+static unsigned fragmentation(const multi_heap_info_t& heap) {
+    if (!heap.total_free_bytes) return 0;
+    return 100 - (unsigned)((100ULL * heap.largest_free_block) / heap.total_free_bytes);
+}
+
+void MemoryPolicy::printReport(Print& out) {
+    out.printf("=== Memory pools ===\n");
+    for (uint8_t i = 0; i < static_cast<uint8_t>(MemPool::COUNT); i++) {
+        MemPool pool = static_cast<MemPool>(i);
+        const Stats& s = stats[i];
+        multi_heap_info_t heap;
+        heap_caps_get_info(&heap, caps(pool));
+        size_t total = heap.total_free_bytes + heap.total_allocated_bytes;
+
+        out.printf("%-8s heap %7u / %7u used  low-water free %7u  biggest free %7u  frag %3u%%%s\n",
+                   name(pool), (unsigned)heap.total_allocated_bytes, (unsigned)total,
+                   (unsigned)heap.minimum_free_bytes, (unsigned)heap.largest_free_block,
+                   fragmentation(heap), isLow(pool) ? "  LOW" : "");
+        out.printf("         policy %7u bytes in %lu blocks  peak %7u  fallbacks %lu  failures %lu\n",
+                   (unsigned)s.bytes, (unsigned long)s.blocks, (unsigned)s.peak,
+                   (unsigned long)s.fallbacks, (unsigned long)s.failures);
+    }
+    out.printf("failed allocations (all code) %lu", (unsigned long)systemFailures);
+    if (systemFailures) {
+        out.printf(", last %u bytes caps 0x%lx", (unsigned)lastFailedSize, (unsigned long)lastFailedCaps);
+    }
+    out.printf("\n");
+}
+
+/**
+ * @brief One line: free / biggest free block / fragmentation of each pool.
+ */
+void MemoryPolicy::printSummary(Print& out) {
+    out.printf("[MemoryPolicy]");
+    for (uint8_t i = 0; i < static_cast<uint8_t>(MemPool::COUNT); i++) {
+        MemPool pool = static_cast<MemPool>(i);
+        multi_heap_info_t heap;
+        heap_caps_get_info(&heap, caps(pool));
+        out.printf(" %s %u/%u %u%%%s", name(pool), (unsigned)heap.total_free_bytes,
+                   (unsigned)heap.largest_free_block, fragmentation(heap), isLow(pool) ? " LOW" : "");
+    }
+    out.printf(" failures %lu\n", (unsigned long)systemFailures);
+}
+
+void MemoryPolicy::loop() {
+#if MEMORY_REPORT_PERIOD_MS > 0
+    if (millis() - lastReport < MEMORY_REPORT_PERIOD_MS) return;
+    lastReport = millis();
+    printSummary(Serial);
+#endif
+}
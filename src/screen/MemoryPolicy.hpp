@@ -0,0 +1,110 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   MemoryPolicy.hpp                               :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/19 16:03:18 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/19 16:03:18 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file MemoryPolicy.hpp
+ * @brief Decides where long-lived buffers live and watches the heaps.
+ *
+ * Three named pools:
+ *   DMA       internal SRAM reachable by the LCD DMA (draw buffers)
+ *   INTERNAL  internal SRAM for small, hot data
+ *   PSRAM     8 MB OPI PSRAM for bulk data (LVGL page arenas, traces).
+ *             Falls back to INTERNAL only while that keeps
+ *             MEMORY_INTERNAL_RESERVE bytes free
+ * Each pool keeps what went through this layer (bytes, blocks, peak,
+ * fallbacks, failures) next to the system view of its capability
+ * (free, low-water mark, largest free block, fragmentation).
+ * Allocation failures anywhere in the firmware are counted through the
+ * ESP-IDF failed-allocation hook.
+ */
+
+#ifndef MEMORY_POLICY_HPP
+#define MEMORY_POLICY_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/** @brief Period of the one-line serial heap report, 0 to disable. */
+#ifndef MEMORY_REPORT_PERIOD_MS
+#define MEMORY_REPORT_PERIOD_MS 60000
+#endif
+
+/** @brief Internal SRAM that PSRAM fallbacks must leave free. */
+#ifndef MEMORY_INTERNAL_RESERVE
+#define MEMORY_INTERNAL_RESERVE (64 * 1024)
+#endif
+
+class Print;
+
+enum class MemPool : uint8_t {
+    DMA = 0,
+    INTERNAL,
+    PSRAM,
+    COUNT
+};
+
+class MemoryPolicy {
+public:
+    /**
+     * @brief Registers the failed-allocation hook. Allocations work before
+     * begin(); only the hook and the periodic report need it.
+     */
+    static void begin();
+
+    /**
+     * @brief Prints the one-line report every MEMORY_REPORT_PERIOD_MS.
+     */
+    static void loop();
+
+    /**
+     * @brief Allocates from a pool.
+     * @param pool Pool.
+     * @param size Bytes.
+     * @param tag Short name shown when the allocation fails.
+     * @return nullptr on failure (logged).
+     */
+    static void* alloc(MemPool pool, size_t size, const char* tag);
+
+    /**
+     * @brief Frees a block allocated with alloc() from the same pool.
+     */
+    static void free(MemPool pool, void* ptr);
+
+    static const char* name(MemPool pool);
+
+    /**
+     * @brief True when the pool's largest free block is below its warning level.
+     */
+    static bool isLow(MemPool pool);
+
+    static void printReport(Print& out);
+    static void printSummary(Print& out);
+
+private:
+    struct Stats {
+        size_t bytes;
+        size_t peak;
+        uint32_t blocks;
+        uint32_t fallbacks;
+        uint32_t failures;
+    };
+
+    static Stats stats[static_cast<uint8_t>(MemPool::COUNT)];
+    static uint32_t systemFailures;
+    static size_t lastFailedSize;
+    static uint32_t lastFailedCaps;
+    static uint32_t lastReport;
+
+    static uint32_t caps(MemPool pool);
+    static void on_alloc_failed(size_t size, uint32_t caps, const char* function);
+};
+
+#endif // MEMORY_POLICY_HPP
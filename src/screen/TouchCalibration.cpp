@@ -0,0 +1,137 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   TouchCalibration.cpp                           :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 09:12:41 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 09:12:41 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file TouchCalibration.cpp
+ * @brief Implementation of the fixed-point affine touch calibration.
+ */
+
+#include "TouchCalibration.hpp"
+#include <Preferences.h>
+
+TouchCalibration::TouchCalibration()
+    : a(1 << FRACTION_BITS), b(0), c(0), d(0), e(1 << FRACTION_BITS), f(0), rotation(0), custom(false) {}
+
+TouchCalibration TouchCalibration::forRotation(uint8_t rotation) {
+    constexpr int32_t ONE = 1 << FRACTION_BITS;
+    TouchCalibration cal;
+    cal.rotation = rotation;
+    switch (rotation) {
+        case 0:
+        case 1:
+            // x = rawY, y = 320 - rawX
+            cal.a = 0;    cal.b = ONE;  cal.c = 0;
+            cal.d = -ONE; cal.e = 0;    cal.f = SCREEN_HEIGHT * ONE;
+            break;
+        case 2:
+        case 3:
+            // x = 480 - rawY, y = rawX
+            cal.a = 0;    cal.b = -ONE; cal.c = SCREEN_WIDTH * ONE;
+            cal.d = ONE;  cal.e = 0;    cal.f = 0;
+            break;
+    }
+    return cal;
+}
+
+/**
+ * @brief Divide a 64-bit numerator by the determinant into Q16, rounding to nearest.
+ */
+static int64_t toFixed(int64_t num, int64_t div) {
+    int64_t scaled = num * (1LL << TouchCalibration::FRACTION_BITS);
+    if ((scaled < 0) != (div < 0)) return (scaled - div / 2) / div;
+    return (scaled + div / 2) / div;
+}
+
+bool TouchCalibration::computeFromPoints(const Point s[3], const Point r[3], uint8_t rot) {
+    int64_t div = (int64_t)(r[0].x - r[2].x) * (r[1].y - r[2].y)
+                - (int64_t)(r[1].x - r[2].x) * (r[0].y - r[2].y);
+    if (div == 0) {
+        Serial.println("[TouchCalibration] ERROR: reference points are collinear");
+        return false;
+    }
+
+    int64_t k[6];
+    k[0] = toFixed((int64_t)(s[0].x - s[2].x) * (r[1].y - r[2].y)
+                 - (int64_t)(s[1].x - s[2].x) * (r[0].y - r[2].y), div);
+    k[1] = toFixed((int64_t)(r[0].x - r[2].x) * (s[1].x - s[2].x)
+                 - (int64_t)(s[0].x - s[2].x) * (r[1].x - r[2].x), div);
+    k[2] = toFixed((int64_t)r[0].y * ((int64_t)r[2].x * s[1].x - (int64_t)r[1].x * s[2].x)
+                 + (int64_t)r[1].y * ((int64_t)r[0].x * s[2].x - (int64_t)r[2].x * s[0].x)
+                 + (int64_t)r[2].y * ((int64_t)r[1].x * s[0].x - (int64_t)r[0].x * s[1].x), div);
+    k[3] = toFixed((int64_t)(s[0].y - s[2].y) * (r[1].y - r[2].y)
+                 - (int64_t)(s[1].y - s[2].y) * (r[0].y - r[2].y), div);
+    k[4] = toFixed((int64_t)(r[0].x - r[2].x) * (s[1].y - s[2].y)
+                 - (int64_t)(s[0].y - s[2].y) * (r[1].x - r[2].x), div);
+    k[5] = toFixed((int64_t)r[0].y * ((int64_t)r[2].x * s[1].y - (int64_t)r[1].x * s[2].y)
+                 + (int64_t)r[1].y * ((int64_t)r[0].x * s[2].y - (int64_t)r[2].x * s[0].y)
+                 + (int64_t)r[2].y * ((int64_t)r[1].x * s[0].y - (int64_t)r[0].x * s[1].y), div);
+
+    const int indexes[] = {0, 1, 3, 4};
+    for (int i : indexes) {
+        if (k[i] > MAX_SCALE || k[i] < -MAX_SCALE) {
+            Serial.println("[TouchCalibration] ERROR: calibration out of range");
+            return false;
+        }
+    }
+    constexpr int64_t MAX_OFFSET = 4LL * SCREEN_WIDTH << FRACTION_BITS;
+    if (k[2] > MAX_OFFSET || k[2] < -MAX_OFFSET || k[5] > MAX_OFFSET || k[5] < -MAX_OFFSET) {
+        Serial.println("[TouchCalibration] ERROR: calibration offset out of range");
+        return false;
+    }
+
+    a = (int32_t)k[0]; b = (int32_t)k[1]; c = (int32_t)k[2];
+    d = (int32_t)k[3]; e = (int32_t)k[4]; f = (int32_t)k[5];
+    rotation = rot;
+    custom = true;
+    return true;
+}
+
+bool TouchCalibration::load(uint8_t rot) {
+    Preferences prefs;
+    if (!prefs.begin(NVS_NAMESPACE, true)) return false;
+    Stored stored;
+    size_t len = prefs.getBytes(NVS_KEY, &stored, sizeof(stored));
+    prefs.end();
+
+    if (len != sizeof(stored) || stored.version != NVS_VERSION || stored.rotation != rot) {
+        return false;
+    }
+    a = stored.coef[0]; b = stored.coef[1]; c = stored.coef[2];
+    d = stored.coef[3]; e = stored.coef[4]; f = stored.coef[5];
+    rotation = rot;
+    custom = true;
+    return true;
+}
+
+bool TouchCalibration::save() const {
+    Preferences prefs;
+    if (!prefs.begin(NVS_NAMESPACE, false)) {
+        Serial.println("[TouchCalibration] ERROR: cannot open NVS");
+        return false;
+    }
+    Stored stored = {NVS_VERSION, rotation, {a, b, c, d, e, f}};
+    bool ok = prefs.putBytes(NVS_KEY, &stored, sizeof(stored)) == sizeof(stored);
+    prefs.end();
+    return ok;
+}
+
+void TouchCalibration::erase() {
+    Preferences prefs;
+    if (!prefs.begin(NVS_NAMESPACE, false)) return;
+    prefs.remove(NVS_KEY);
+    prefs.end();
+}
+
+void TouchCalibration::print() const {
+    Serial.printf("[TouchCalibration] %s rot=%d x=(%ld,%ld,%ld) y=(%ld,%ld,%ld) Q%d\n",
+                  custom ? "custom" : "default", rotation,
+                  (long)a, (long)b, (long)c, (long)d, (long)e, (long)f, FRACTION_BITS);
+}
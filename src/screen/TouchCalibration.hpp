@@ -0,0 +1,97 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   TouchCalibration.hpp                           :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 09:12:41 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 09:12:41 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file TouchCalibration.hpp
+ * @brief Fixed-point affine touch calibration (rotation folded in).
+ *
+ * Maps raw controller coordinates to screen coordinates with
+ *   x = (a * rawX + b * rawY + c) >> 16
+ *   y = (d * rawX + e * rawY + f) >> 16
+ * The matrix is computed once from three reference points and stored in NVS.
+ */
+
+#ifndef TOUCH_CALIBRATION_HPP
+#define TOUCH_CALIBRATION_HPP
+
+#include <Arduino.h>
+
+class TouchCalibration {
+public:
+    static constexpr int FRACTION_BITS = 16;
+    static constexpr uint16_t SCREEN_WIDTH = 480;
+    static constexpr uint16_t SCREEN_HEIGHT = 320;
+
+    struct Point {
+        int32_t x;
+        int32_t y;
+    };
+
+    TouchCalibration();
+
+    /**
+     * @brief Default matrix equivalent to the factory mapping for a rotation.
+     * @param rotation Screen rotation (0..3).
+     */
+    static TouchCalibration forRotation(uint8_t rotation);
+
+    /**
+     * @brief Solve the affine matrix from three non-collinear reference points.
+     * @param screen Target positions in screen coordinates.
+     * @param raw Raw controller readings for those targets.
+     * @param rotation Rotation the points were taken with.
+     * @return false if the points are degenerate or the result is out of range.
+     */
+    bool computeFromPoints(const Point screen[3], const Point raw[3], uint8_t rotation);
+
+    /**
+     * @brief Apply the matrix to a raw sample (two multiply-adds per axis, no division).
+     * The half unit added before the shift rounds to nearest (a plain shift floors).
+     */
+    inline void apply(uint16_t rawX, uint16_t rawY, uint16_t& x, uint16_t& y) const {
+        constexpr int32_t HALF = 1 << (FRACTION_BITS - 1);
+        int32_t sx = (a * rawX + b * rawY + c + HALF) >> FRACTION_BITS;
+        int32_t sy = (d * rawX + e * rawY + f + HALF) >> FRACTION_BITS;
+        x = (uint16_t)(sx < 0 ? 0 : (sx >= SCREEN_WIDTH ? SCREEN_WIDTH - 1 : sx));
+        y = (uint16_t)(sy < 0 ? 0 : (sy >= SCREEN_HEIGHT ? SCREEN_HEIGHT - 1 : sy));
+    }
+
+    /**
+     * @brief Load the stored matrix if it was taken with the given rotation.
+     */
+    bool load(uint8_t rotation);
+    bool save() const;
+    static void erase();
+
+    uint8_t getRotation() const { return rotation; }
+    bool isCustom() const { return custom; }
+    void print() const;
+
+private:
+    static constexpr const char* NVS_NAMESPACE = "touch";
+    static constexpr const char* NVS_KEY = "cal";
+    static constexpr uint8_t NVS_VERSION = 1;
+    // Calibrations further than this from 1:1 are rejected (also keeps the int32 math safe).
+    static constexpr int32_t MAX_SCALE = 4 << FRACTION_BITS;
+
+    struct Stored {
+        uint8_t version;
+        uint8_t rotation;
+        int32_t coef[6];
+    };
+
+    int32_t a, b, c;
+    int32_t d, e, f;
+    uint8_t rotation;
+    bool custom;
+};
+
+#endif // TOUCH_CALIBRATION_HPP
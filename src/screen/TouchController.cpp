@@ -16,8 +16,15 @@
 
 #include "TouchController.hpp"
 
+volatile uint32_t TouchController::irqUs = 0;
+
 TouchController::TouchController()
-    : initialized(false), screenRotation(0) {}
+    : initialized(false), screenRotation(0), calibration(TouchCalibration::forRotation(0)),
+      lastRawX(0), lastRawY(0), lastSampleUs(0) {}
+
+void IRAM_ATTR TouchController::on_touch_irq() {
+    irqUs = micros();
+}
 
 bool TouchController::begin() {
     Wire.begin(PIN_SDA, PIN_SCL);
@@ -37,6 +44,8 @@ bool TouchController::begin() {
         return false;
     }
 
+    attachInterrupt(digitalPinToInterrupt(PIN_INT), on_touch_irq, FALLING);
+
     initialized = true;
     Serial.println("Contrôleur tactile initialisé");
     return true;
@@ -45,6 +54,15 @@ bool TouchController::begin() {
 void TouchController::setRotation(uint8_t rotation) {
     if (rotation > 3) rotation = 0;
     screenRotation = rotation;
+    calibration = TouchCalibration::forRotation(rotation);
+    calibration.load(rotation);
+    calibration.print();
+}
+
+void TouchController::resetCalibration() {
+    TouchCalibration::erase();
+    calibration = TouchCalibration::forRotation(screenRotation);
+    calibration.print();
 }
 
 bool TouchController::sendReadCommand() {
@@ -80,6 +98,8 @@ bool TouchController::decodeTouchData(uint8_t* data, uint16_t& x, uint16_t& y) {
     if (rawX > 500 || rawY > 500) {
         return false;
     }
+    lastRawX = rawX;
+    lastRawY = rawY;
     calibrateCoordinates(rawX, rawY, x, y);
     static int touch_count = 0;
     if (++touch_count % 20 == 0) {
@@ -89,24 +109,7 @@ bool TouchController::decodeTouchData(uint8_t* data, uint16_t& x, uint16_t& y) {
 }
 
 void TouchController::calibrateCoordinates(uint16_t rawX, uint16_t rawY, uint16_t& x, uint16_t& y) {
-    switch (screenRotation) {
-        case 0:
-            x = rawY;
-            y = map(rawX, 0, 320, 320, 0);
-            break;
-        case 1:
-            x = map(rawY, 0, 480, 0, 480);
-            y = map(rawX, 0, 320, 320, 0);
-            break;
-        case 2:
-            x = map(rawY, 0, 480, 480, 0);
-            y = rawX;
-            break;
-        case 3:
-            x = map(rawY, 0, 480, 480, 0);
-            y = map(rawX, 0, 320, 0, 320);
-            break;
-    }
+    calibration.apply(rawX, rawY, x, y);
 }
 
 bool TouchController::isTouched() {
@@ -120,7 +123,11 @@ bool TouchController::getTouchPoint(uint16_t& x, uint16_t& y) {
     if (!sendReadCommand()) return false;
     uint8_t data[MAX_TOUCH_POINTS * 6 + 2] = {0};
     if (!readTouchData(data)) return false;
-    return decodeTouchData(data, x, y);
+    if (!decodeTouchData(data, x, y)) return false;
+    uint32_t irq = irqUs;
+    lastSampleUs = (irq != 0 && irq - lastSampleUs < 0x80000000UL) ? irq : micros();
+    irqUs = 0;
+    return true;
 }
 
 bool TouchController::waitForTouch(uint32_t timeout_ms) {
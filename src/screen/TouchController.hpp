@@ -19,6 +19,7 @@
 
 #include <Arduino.h>
 #include <Wire.h>
+#include "TouchCalibration.hpp"
 
 class TouchController {
 private:
@@ -32,6 +33,13 @@ private:
 
     bool initialized;
     uint8_t screenRotation;
+    TouchCalibration calibration;
+    uint16_t lastRawX;
+    uint16_t lastRawY;
+    uint32_t lastSampleUs;
+
+    static volatile uint32_t irqUs;
+    static void IRAM_ATTR on_touch_irq();
 
     bool sendReadCommand();
     bool readTouchData(uint8_t* data);
@@ -47,6 +55,20 @@ public:
     bool getTouchPoint(uint16_t& x, uint16_t& y);
     bool waitForTouch(uint32_t timeout_ms = 0);
     bool waitForRelease(uint32_t timeout_ms = 0);
+
+    /**
+     * @brief Last raw controller sample (before calibration), used by the calibration screen.
+     */
+    void getLastRawPoint(uint16_t& rawX, uint16_t& rawY) const { rawX = lastRawX; rawY = lastRawY; }
+    const TouchCalibration& getCalibration() const { return calibration; }
+    void setCalibration(const TouchCalibration& cal) { calibration = cal; }
+    void resetCalibration();
+
+    /**
+     * @brief Time (micros) the last sample became available: the controller IRQ
+     * if one fired since the previous sample, otherwise the poll itself.
+     */
+    uint32_t getLastSampleTime() const { return lastSampleUs; }
 };
 
 #endif // TOUCH_CONTROLLER_HPP
@@ -0,0 +1,86 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   TouchTrace.cpp                                 :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 13:22:10 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 13:22:10 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file TouchTrace.cpp
+ * @brief Implementation of the touch trace recorder and player.
+ */
+
+#include "TouchTrace.hpp"
+
+void TouchTrace::attach(uint32_t* storage, size_t cap) {
+    records = storage;
+    maxCount = storage ? cap : 0;
+    clear();
+}
+
+void TouchTrace::clear() {
+    count = 0;
+    lastTimeMs = 0;
+    last = Sample{0, 0, false};
+}
+
+bool TouchTrace::append(uint32_t timeMs, const Sample& s) {
+    if (!records) return false;
+    if (count == 0) {
+        lastTimeMs = timeMs;
+    } else if (s.pressed == last.pressed && (!s.pressed || (s.x == last.x && s.y == last.y))) {
+        return true;
+    }
+
+    uint32_t delta = timeMs - lastTimeMs;
+    while (delta > MAX_DELTA_MS) {
+        if (count >= maxCount) return false;
+        records[count++] = encode(MAX_DELTA_MS, last);
+        delta -= MAX_DELTA_MS;
+    }
+    if (count >= maxCount) return false;
+    records[count++] = encode(delta, s);
+    lastTimeMs = timeMs;
+    last = s;
+    return true;
+}
+
+uint32_t TouchTrace::durationMs() const {
+    uint32_t total = 0;
+    for (size_t i = 0; i < count; i++) total += deltaOf(records[i]);
+    return total;
+}
+
+void TouchTracePlayer::start(const TouchTrace* t, uint32_t nowMs, uint16_t speedPercent) {
+    trace = (t && t->size()) ? t : nullptr;
+    index = 0;
+    startMs = nowMs;
+    speed = speedPercent ? speedPercent : 100;
+    current = TouchTrace::Sample{0, 0, false};
+    nextAtMs = trace ? TouchTrace::deltaOf(trace->data()[0]) : 0;
+}
+
+bool TouchTracePlayer::read(uint32_t nowMs, TouchTrace::Sample& out) {
+    if (!trace) {
+        out = TouchTrace::Sample{current.x, current.y, false};
+        return false;
+    }
+    uint32_t traceMs = (uint32_t)((uint64_t)(nowMs - startMs) * speed / 100);
+    const uint32_t* records = trace->data();
+    while (index < trace->size() && nextAtMs <= traceMs) {
+        current = TouchTrace::decode(records[index]);
+        index++;
+        if (index < trace->size()) nextAtMs += TouchTrace::deltaOf(records[index]);
+    }
+    out = current;
+    if (index >= trace->size()) {
+        trace = nullptr;
+        out.pressed = false;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,98 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   TouchTrace.hpp                                 :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/18 13:22:10 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/18 13:22:10 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file TouchTrace.hpp
+ * @brief Compact binary touch trace and its player.
+ *
+ * A trace is a sequence of 32-bit records, one per change of touch state:
+ *   bits  0..11  milliseconds since the previous record (gaps are split)
+ *   bit  12      pressed
+ *   bits 13..21  x (0..511)
+ *   bits 22..30  y (0..511)
+ * No Arduino dependency, so the same code can run in a host build.
+ */
+
+#ifndef TOUCH_TRACE_HPP
+#define TOUCH_TRACE_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+class TouchTrace {
+public:
+    static constexpr uint32_t MAX_DELTA_MS = 0xFFF;
+
+    struct Sample {
+        uint16_t x;
+        uint16_t y;
+        bool pressed;
+    };
+
+    void attach(uint32_t* storage, size_t capacity);
+    void clear();
+
+    /**
+     * @brief Record a sample; identical consecutive samples are folded into the next delta.
+     * @return false when the trace is full.
+     */
+    bool append(uint32_t timeMs, const Sample& sample);
+
+    size_t size() const { return count; }
+    size_t capacity() const { return maxCount; }
+    uint32_t* data() { return records; }
+    const uint32_t* data() const { return records; }
+    void setSize(size_t n) { count = n <= maxCount ? n : maxCount; }
+    uint32_t durationMs() const;
+
+    static uint32_t encode(uint32_t deltaMs, const Sample& s) {
+        return (deltaMs & MAX_DELTA_MS) | ((uint32_t)s.pressed << 12)
+             | ((uint32_t)(s.x & 0x1FF) << 13) | ((uint32_t)(s.y & 0x1FF) << 22);
+    }
+    static uint32_t deltaOf(uint32_t r) { return r & MAX_DELTA_MS; }
+    static Sample decode(uint32_t r) {
+        return Sample{(uint16_t)((r >> 13) & 0x1FF), (uint16_t)((r >> 22) & 0x1FF), ((r >> 12) & 1) != 0};
+    }
+
+private:
+    uint32_t* records = nullptr;
+    size_t maxCount = 0;
+    size_t count = 0;
+    uint32_t lastTimeMs = 0;
+    Sample last = {0, 0, false};
+};
+
+class TouchTracePlayer {
+public:
+    /**
+     * @brief Start playing a trace.
+     * @param speedPercent 100 = original speed, 400 = four times faster.
+     */
+    void start(const TouchTrace* trace, uint32_t nowMs, uint16_t speedPercent = 100);
+    void stop() { trace = nullptr; }
+    bool isPlaying() const { return trace != nullptr; }
+
+    /**
+     * @brief Sample the trace at the given time.
+     * @return false once the trace is finished (the last sample is released).
+     */
+    bool read(uint32_t nowMs, TouchTrace::Sample& out);
+
+private:
+    const TouchTrace* trace = nullptr;
+    size_t index = 0;
+    uint32_t startMs = 0;
+    uint32_t nextAtMs = 0; // trace time of records[index]
+    uint16_t speed = 100;
+    TouchTrace::Sample current = {0, 0, false};
+};
+
+#endif // TOUCH_TRACE_HPP
@@ -0,0 +1,145 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   UiTask.cpp                                     :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/20 09:14:26 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/20 09:14:26 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file UiTask.cpp
+ * @brief Implementation of the UI task and the UI lock.
+ */
+
+#include "UiTask.hpp"
+#include "DisplayLVGL.hpp"
+#include <Arduino.h>
+
+DisplayLVGL* UiTask::display = nullptr;
+UiWork UiTask::work = nullptr;
+void* UiTask::workCtx = nullptr;
+TaskHandle_t UiTask::handle = nullptr;
+SemaphoreHandle_t UiTask::mutex = nullptr;
+LoadMeter UiTask::load;
+uint32_t UiTask::frames = 0;
+std::atomic<uint32_t> UiTask::lockWaits(0);
+std::atomic<uint32_t> UiTask::lockWaitMaxUs(0);
+std::atomic<uint32_t> UiTask::lockTimeouts(0);
+
+void LoadMeter::begin() {
+    start = micros();
+    if (!windowStart) windowStart = start;
+}
+
+void LoadMeter::end() {
+    uint32_t now = micros();
+    uint32_t spent = now - start;
+    busy += spent;
+    if (spent > longest) longest = spent;
+
+    uint32_t window = now - windowStart;
+    if (window >= 1000000) {
+        load = (uint8_t)((100ULL * busy) / window);
+        busy = 0;
+        windowStart = now;
+    }
+}
+
+bool UiTask::begin(DisplayLVGL* disp, UiWork fn, void* ctx) {
+    if (handle || !disp) return false;
+    display = disp;
+    work = fn;
+    workCtx = ctx;
+
+    mutex = xSemaphoreCreateRecursiveMutex();
+    if (!mutex) {
+        Serial.println("[UiTask] ERROR: lock creation failed");
+        return false;
+    }
+    if (xTaskCreatePinnedToCore(run, "ui", UI_TASK_STACK, nullptr, UI_TASK_PRIORITY,
+                                &handle, UI_TASK_CORE) != pdPASS) {
+        Serial.println("[UiTask] ERROR: task creation failed");
+        handle = nullptr;
+        return false;
+    }
+    Serial.printf("[UiTask] Started on core %d, priority %d, %d ms frames\n",
+                  UI_TASK_CORE, UI_TASK_PRIORITY, UI_TASK_PERIOD_MS);
+    return true;
+}
+
+bool UiTask::lock(uint32_t timeoutMs) {
+    if (!mutex) return true;
+    if (xSemaphoreTakeRecursive(mutex, 0) == pdTRUE) return true;
+
+    lockWaits.fetch_add(1, std::memory_order_relaxed);
+    uint32_t start = micros();
+    TickType_t ticks = timeoutMs == portMAX_DELAY ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+    if (xSemaphoreTakeRecursive(mutex, ticks) != pdTRUE) {
+        lockTimeouts.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    uint32_t waited = micros() - start;
+    uint32_t peak = lockWaitMaxUs.load(std::memory_order_relaxed);
+    while (waited > peak && !lockWaitMaxUs.compare_exchange_weak(peak, waited, std::memory_order_relaxed)) {}
+    return true;
+}
+
+void UiTask::unlock() {
+    if (mutex) xSemaphoreGiveRecursive(mutex);
+}
+
+bool UiTask::isUiTask() {
+    return handle && xTaskGetCurrentTaskHandle() == handle;
+}
+
+void UiTask::run(void* arg) {
+    TickType_t wake = xTaskGetTickCount();
+    for (;;) {
+        lock();
+        load.begin();
+        display->loop();
+        if (work) work(workCtx);
+        load.end();
+        unlock();
+        frames++;
+        TickType_t period = pdMS_TO_TICKS(UI_TASK_PERIOD_MS);
+        if (xTaskGetTickCount() - wake >= period) {
+            // Frame overran its slot: vTaskDelayUntil would return at once
+            wake = xTaskGetTickCount();
+            vTaskDelay(1);
+        } else {
+            vTaskDelayUntil(&wake, period);
+        }
+    }
+}
+
+void UiTask::printReport(Print& out, const LoadMeter* loopLoad) {
+    out.printf("=== Tasks ===\n");
+    if (handle) {
+        out.printf("ui    core %d prio %d  busy %3u%%  longest frame %lu us  frames %lu  stack free %u\n",
+                   UI_TASK_CORE, UI_TASK_PRIORITY, (unsigned)load.percent(), (unsigned long)load.maxUs(),
+                   (unsigned long)frames, (unsigned)uxTaskGetStackHighWaterMark(handle));
+    } else {
+        out.printf("ui    not started (LVGL runs in loop())\n");
+    }
+    if (loopLoad) {
+        // Called from the loop task: nullptr is the calling task
+        out.printf("loop  core %d prio %u  busy %3u%%  longest pass %lu us  stack free %u\n",
+                   (int)xPortGetCoreID(), (unsigned)uxTaskPriorityGet(nullptr),
+                   (unsigned)loopLoad->percent(), (unsigned long)loopLoad->maxUs(),
+                   (unsigned)uxTaskGetStackHighWaterMark(nullptr));
+    }
+    out.printf("lock  waits %lu  longest wait %lu us  timeouts %lu\n",
+               (unsigned long)lockWaits.load(), (unsigned long)lockWaitMaxUs.load(),
+               (unsigned long)lockTimeouts.load());
+#if defined(configGENERATE_RUN_TIME_STATS) && configGENERATE_RUN_TIME_STATS == 1 \
+    && defined(configUSE_STATS_FORMATTING_FUNCTIONS) && configUSE_STATS_FORMATTING_FUNCTIONS == 1
+    // All tasks, when the SDK was built with run-time stats
+    static char stats[1024];
+    vTaskGetRunTimeStats(stats);
+    out.printf("%s", stats);
+#endif
+}
@@ -0,0 +1,144 @@
+/* **************************************************************************** */
+/*                                                                              */
+/*                                                  ::::    :::     ::::::::    */
+/*   UiTask.hpp                                     :+:+:   :+:    :+:    :+:   */
+/*                                                  :+:+:+  +:+    +:+          */
+/*   By: Louis Croci <louis.croci@epitech.eu>       +#+ +:+ +#+    +#++:++#++   */
+/*                                                  +#+  +#+#+#           +#+   */
+/*   Created: 2026/10/20 09:14:26 by Louis Croci    #+#   #+#+#    #+#    #+#   */
+/*   Updated: 2026/10/20 09:14:26 by Louis Croci    ###    ####     ########    */
+/*                                                                              */
+/* **************************************************************************** */
+/**
+ * @file UiTask.hpp
+ * @brief FreeRTOS task that owns LVGL, and the lock other tasks use to reach it.
+ *
+ * The UI task runs DisplayLVGL::loop (tick, touch read, timers, rendering)
+ * and the UiWork callback (page manager, soak test) every UI_TASK_PERIOD_MS,
+ * pinned to UI_TASK_CORE. It holds the UI lock while it works.
+ * Any other task (Arduino loop, WiFi, MQTT, sensors) must hold the lock
+ * (UiLock) while touching LVGL objects, the UI store or the pages.
+ * The lock is recursive, so code that already runs in the UI task
+ * (LVGL event callbacks) can take it again.
+ * Busy time is measured per task with LoadMeter.
+ */
+
+#ifndef UI_TASK_HPP
+#define UI_TASK_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+/** @brief Core of the UI task (WiFi runs on core 0). */
+#ifndef UI_TASK_CORE
+#define UI_TASK_CORE 1
+#endif
+
+/**
+ * @brief Above the Arduino loop task (1), below the WiFi/LwIP tasks.
+ * Both share core 1, so run() always blocks at least one tick per frame:
+ * an overrunning frame must not starve loopTask or the idle task.
+ */
+#ifndef UI_TASK_PRIORITY
+#define UI_TASK_PRIORITY 3
+#endif
+
+#ifndef UI_TASK_STACK
+#define UI_TASK_STACK 8192
+#endif
+
+/** @brief Frame period: LVGL timers and touch read run at most this often. */
+#ifndef UI_TASK_PERIOD_MS
+#define UI_TASK_PERIOD_MS 5
+#endif
+
+class DisplayLVGL;
+class Print;
+
+typedef void (*UiWork)(void* ctx);
+
+/**
+ * @brief Busy time of a task over one-second windows.
+ * Call begin() / end() around the task's work.
+ */
+class LoadMeter {
+public:
+    void begin();
+    void end();
+    uint8_t percent() const { return load; }
+    uint32_t maxUs() const { return longest; }
+
+private:
+    uint32_t start = 0;
+    uint32_t windowStart = 0;
+    uint32_t busy = 0;
+    uint32_t longest = 0;
+    uint8_t load = 0;
+};
+
+class UiTask {
+public:
+    /**
+     * @brief Creates the lock and starts the UI task. Until then, setup()
+     * is the only task and lock() always succeeds.
+     * @param display Display driven by the task.
+     * @param work Called every frame after the display, under the lock.
+     * @param ctx Passed to work.
+     */
+    static bool begin(DisplayLVGL* display, UiWork work, void* ctx);
+
+    /**
+     * @brief Takes the UI lock (recursive).
+     * @param timeoutMs portMAX_DELAY to wait forever.
+     * @return False on timeout.
+     */
+    static bool lock(uint32_t timeoutMs = portMAX_DELAY);
+    static void unlock();
+
+    static bool isUiTask();
+
+    /**
+     * @brief UI task load, frame times, lock contention and stacks
+     * (plus FreeRTOS run-time stats when the SDK enables them).
+     */
+    static void printReport(Print& out, const LoadMeter* loopLoad = nullptr);
+
+private:
+    static DisplayLVGL* display;
+    static UiWork work;
+    static void* workCtx;
+    static TaskHandle_t handle;
+    static SemaphoreHandle_t mutex;
+    static LoadMeter load;
+    static uint32_t frames;
+    // Updated by every task that waits for the lock, before it holds it
+    static std::atomic<uint32_t> lockWaits;
+    static std::atomic<uint32_t> lockWaitMaxUs;
+    static std::atomic<uint32_t> lockTimeouts;
+
+    static void run(void* arg);
+};
+
+/**
+ * @brief Scoped UI lock.
+ *
+ *   UiLock lock;
+ *   UiStore::set(UiKey::PH, ph);
+ */
+class UiLock {
+public:
+    explicit UiLock(uint32_t timeoutMs = portMAX_DELAY) : held(UiTask::lock(timeoutMs)) {}
+    ~UiLock() { if (held) UiTask::unlock(); }
+    UiLock(const UiLock&) = delete;
+    UiLock& operator=(const UiLock&) = delete;
+
+    explicit operator bool() const { return held; }
+
+private:
+    bool held;
+};
+
+#endif // UI_TASK_HPP